@@ -3,14 +3,23 @@
 uniform sampler2D tex;
 uniform bool flip_tex_hor;
 uniform bool flip_tex_ver;
-uniform vec4 material_ambient;
-uniform vec4 material_diffuse;
-uniform vec4 material_specular;
-uniform float material_shininess;
-uniform int is_affected_by_light;
-uniform vec3 light_positions[32];
-uniform float light_powers[32];
-uniform vec3 eye_pos;
+
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 proj;
+    vec4 eye_pos;
+    vec4 lights[32]; // xyz: position, w: power
+};
+
+layout(std140) uniform MaterialData
+{
+    vec4 material_ambient;
+    vec4 material_diffuse;
+    vec4 material_specular;
+    float material_shininess;
+    int is_affected_by_light;
+};
 
 in vec2 uv_frag;
 in vec3 normal_interp;
@@ -35,12 +44,12 @@ void main()
 	vec3 normal = normalize(normal_interp);
 
 	// Calculate view direction
-	vec3 view_direction = normalize(eye_pos - frag_pos);
+	vec3 view_direction = normalize(eye_pos.xyz - frag_pos);
 
 	vec4 light_accumulator = vec4(0.0f, 0.0f, 0.0f, 1.0f);
 	for (int i = 0; i < 32; ++i)
 	{
-		vec3 light_direction = normalize(light_positions[i]);
+		vec3 light_direction = normalize(lights[i].xyz);
 
 		vec4 diffuse_color = vec4(0.0f, 0.0f, 0.0f, 1.0f);
 		vec4 specular_color = vec4(0.0f, 0.0f, 0.0f, 1.0f);
@@ -57,8 +66,8 @@ void main()
 			specular_color = clamp(specular_color, 0.0f, 1.0f);
 		}
 		
-		float distance = distance(light_positions[i], frag_unprojected_pos);
-		float attenuation = light_powers[i] / (distance * distance);
+		float distance = distance(lights[i].xyz, frag_unprojected_pos);
+		float attenuation = lights[i].w / (distance * distance);
 
 		light_accumulator.rgb += (diffuse_color * attenuation + specular_color * attenuation).rgb;
 	}
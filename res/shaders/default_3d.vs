@@ -6,8 +6,13 @@ layout(location = 2) in vec3 normal;
 
 uniform mat4 norm;
 uniform mat4 world;
-uniform mat4 view;
-uniform mat4 proj;
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 proj;
+    vec4 eye_pos;
+    vec4 lights[32]; // xyz: position, w: power
+};
 
 out vec2 uv_frag;
 out vec3 normal_interp;
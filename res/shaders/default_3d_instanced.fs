@@ -0,0 +1,84 @@
+#version 330 core
+
+uniform sampler2D tex;
+uniform bool flip_tex_hor;
+uniform bool flip_tex_ver;
+
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 proj;
+    vec4 eye_pos;
+    vec4 lights[32]; // xyz: position, w: power
+};
+
+in vec2 uv_frag;
+in vec3 normal_interp;
+in vec3 frag_pos;
+in vec3 frag_unprojected_pos;
+flat in vec4 material_ambient_frag;
+flat in vec4 material_diffuse_frag;
+flat in vec4 material_specular_frag;
+flat in vec4 material_properties_frag;
+
+out vec4 frag_color;
+
+void main()
+{
+	// Unpack per instance material
+	vec4 material_ambient = material_ambient_frag;
+	vec4 material_diffuse = material_diffuse_frag;
+	vec4 material_specular = material_specular_frag;
+	float material_shininess = material_properties_frag.x;
+	bool is_affected_by_light = material_properties_frag.y > 0.5f;
+
+	// Calculate final uvs
+    float final_uv_x = uv_frag.x;
+    if (flip_tex_hor) final_uv_x = 1.00f - final_uv_x;
+
+    float final_uv_y = 1.00f - uv_frag.y;
+    if (flip_tex_ver) final_uv_y = 1.00f - final_uv_y;
+	
+	// Get texture color
+    vec4 tex_color = texture(tex, vec2(final_uv_x, final_uv_y));
+
+    // Normalize normal 
+	vec3 normal = normalize(normal_interp);
+
+	// Calculate view direction
+	vec3 view_direction = normalize(eye_pos.xyz - frag_pos);
+
+	vec4 light_accumulator = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	for (int i = 0; i < 32; ++i)
+	{
+		vec3 light_direction = normalize(lights[i].xyz);
+
+		vec4 diffuse_color = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		vec4 specular_color = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+		float diffuse_factor = max(dot(normal, light_direction), 0.0f);
+		if (diffuse_factor > 0.0f)
+		{
+			diffuse_color = material_diffuse * diffuse_factor;
+			diffuse_color = clamp(diffuse_color, 0.0f, 1.0f);	
+
+			vec3 reflected_direction = normalize(reflect(-light_direction, normal));
+
+			specular_color = material_specular * pow(max(dot(view_direction, reflected_direction), 0.0f), material_shininess);
+			specular_color = clamp(specular_color, 0.0f, 1.0f);
+		}
+		
+		float distance = distance(lights[i].xyz, frag_unprojected_pos);
+		float attenuation = lights[i].w / (distance * distance);
+
+		light_accumulator.rgb += (diffuse_color * attenuation + specular_color * attenuation).rgb;
+	}
+
+	frag_color = tex_color;
+
+	if (is_affected_by_light)
+	{
+		frag_color = frag_color * material_ambient + light_accumulator;
+	}	
+
+}
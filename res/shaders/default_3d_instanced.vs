@@ -0,0 +1,44 @@
+#version 330 core
+
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec2 uv;
+layout(location = 2) in vec3 normal;
+
+// Per instance attributes
+layout(location = 3) in mat4 world;
+layout(location = 7) in mat4 norm;
+layout(location = 11) in vec4 material_ambient;
+layout(location = 12) in vec4 material_diffuse;
+layout(location = 13) in vec4 material_specular;
+layout(location = 14) in vec4 material_properties;
+
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 proj;
+    vec4 eye_pos;
+    vec4 lights[32]; // xyz: position, w: power
+};
+
+out vec2 uv_frag;
+out vec3 normal_interp;
+out vec3 frag_pos;
+out vec3 frag_unprojected_pos;
+flat out vec4 material_ambient_frag;
+flat out vec4 material_diffuse_frag;
+flat out vec4 material_specular_frag;
+flat out vec4 material_properties_frag;
+
+void main()
+{
+    uv_frag = uv;
+    normal_interp = (norm * vec4(normal, 0.0f)).rgb;
+    frag_unprojected_pos = (world * vec4(position, 1.0f)).rgb;
+    gl_Position = proj * view * vec4(frag_unprojected_pos, 1.0f);
+    frag_pos = gl_Position.rgb;
+
+    material_ambient_frag = material_ambient;
+    material_diffuse_frag = material_diffuse;
+    material_specular_frag = material_specular;
+    material_properties_frag = material_properties;
+}
@@ -0,0 +1,18 @@
+#version 330 core
+
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec2 uv;
+
+// Per instance attributes
+layout(location = 3) in mat4 world;
+layout(location = 15) in vec4 custom_color;
+
+out vec2 uv_frag;
+flat out vec4 custom_color_frag;
+
+void main()
+{
+    uv_frag = uv;
+    custom_color_frag = custom_color;
+    gl_Position = world * vec4(position, 1.0);
+}
@@ -0,0 +1,80 @@
+///------------------------------------------------------------------------------------------------
+///  Benchmark.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef Benchmark_h
+#define Benchmark_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace benchmarks
+{
+
+///------------------------------------------------------------------------------------------------
+/// The outcome of a single timed trial of a benchmark.
+struct BenchmarkMeasurement
+{
+    std::size_t mOperationCount = 0U;
+    double mMilliseconds        = 0.0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Runs a single trial of a benchmark over the given number of entities. Any setup needs to happen
+/// before, and any teardown after, the timed section of the trial.
+using BenchmarkFunction = std::function<BenchmarkMeasurement(const std::size_t entityCount)>;
+
+///------------------------------------------------------------------------------------------------
+/// A named benchmark, along with the entity counts and job system configuration it should run with.
+struct BenchmarkCase
+{
+    std::string mName;
+    std::vector<std::size_t> mEntityCounts;
+    std::size_t mWorkerThreadCount = 0U;
+    BenchmarkFunction mFunction;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Completes the measurement of a timed section that started at the given time point.
+/// @param[in] startTimePoint the time point at which the timed section started.
+/// @param[in] operationCount the number of operations performed in the timed section.
+/// @returns the measurement of the timed section.
+inline BenchmarkMeasurement MeasureSince(const std::chrono::steady_clock::time_point startTimePoint, const std::size_t operationCount)
+{
+    const auto endTimePoint = std::chrono::steady_clock::now();
+    return BenchmarkMeasurement{ operationCount, std::chrono::duration<double, std::milli>(endTimePoint - startTimePoint).count() };
+}
+
+///------------------------------------------------------------------------------------------------
+/// Consumes a value computed in a timed section, so that the compiler can not optimize its computation away.
+/// @param[in] value the value to consume.
+void ConsumeValue(const float value);
+
+///------------------------------------------------------------------------------------------------
+/// Adds the ECS micro-benchmarks (entity, component, iteration and name lookup hot paths).
+/// @param[out] benchmarkCases the list to add the benchmarks to.
+void RegisterEcsBenchmarks(std::vector<BenchmarkCase>& benchmarkCases);
+
+///------------------------------------------------------------------------------------------------
+/// Adds the job system scaling benchmarks, running with 1 up to the given number of cores.
+/// @param[out] benchmarkCases the list to add the benchmarks to.
+/// @param[in] maxCoreCount the maximum number of cores (worker threads plus the main thread) to scale up to.
+void RegisterJobSystemBenchmarks(std::vector<BenchmarkCase>& benchmarkCases, const std::size_t maxCoreCount);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* Benchmark_h */
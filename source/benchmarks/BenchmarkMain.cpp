@@ -0,0 +1,231 @@
+///------------------------------------------------------------------------------------------------
+///  BenchmarkMain.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include "../engine/jobs/JobSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <thread>
+
+///------------------------------------------------------------------------------------------------
+
+namespace benchmarks
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const int DEFAULT_TRIAL_COUNT = 5;
+
+    volatile float sConsumedValue = 0.0f;
+}
+
+///------------------------------------------------------------------------------------------------
+
+enum class OutputFormat
+{
+    JSON, CSV
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct BenchmarkOptions
+{
+    OutputFormat mOutputFormat  = OutputFormat::JSON;
+    std::string mOutputPath;
+    std::string mNameFilter;
+    int mTrialCount             = DEFAULT_TRIAL_COUNT;
+    std::size_t mMaxEntityCount = std::numeric_limits<std::size_t>::max();
+    std::size_t mMaxCoreCount   = std::max(1U, std::thread::hardware_concurrency());
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct BenchmarkResult
+{
+    std::string mName;
+    std::size_t mEntityCount    = 0U;
+    std::size_t mCoreCount      = 0U;
+    std::size_t mOperationCount = 0U;
+    int mTrialCount             = 0;
+    double mBestMilliseconds    = 0.0;
+    double mMeanMilliseconds    = 0.0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+void ConsumeValue(const float value)
+{
+    sConsumedValue = sConsumedValue + value;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static BenchmarkResult RunBenchmark(const BenchmarkCase& benchmarkCase, const std::size_t entityCount, const int trialCount)
+{
+    BenchmarkResult result;
+    result.mName             = benchmarkCase.mName;
+    result.mEntityCount      = entityCount;
+    result.mCoreCount        = benchmarkCase.mWorkerThreadCount + 1U;
+    result.mTrialCount       = trialCount;
+    result.mBestMilliseconds = std::numeric_limits<double>::max();
+
+    for (auto i = 0; i < trialCount; ++i)
+    {
+        const auto measurement = benchmarkCase.mFunction(entityCount);
+        result.mOperationCount    = measurement.mOperationCount;
+        result.mBestMilliseconds  = std::min(result.mBestMilliseconds, measurement.mMilliseconds);
+        result.mMeanMilliseconds += measurement.mMilliseconds/trialCount;
+    }
+
+    return result;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void WriteResults(const std::vector<BenchmarkResult>& results, const OutputFormat outputFormat, std::FILE* outputFile)
+{
+    if (outputFormat == OutputFormat::CSV)
+    {
+        std::fprintf(outputFile, "name,entities,cores,operations,trials,best_ms,mean_ms,best_ns_per_op\n");
+    }
+    else
+    {
+        std::fprintf(outputFile, "{\n  \"benchmarks\": [\n");
+    }
+
+    for (auto i = 0U; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+        const auto bestNanosecondsPerOperation = 1000000.0 * result.mBestMilliseconds/std::max<std::size_t>(1U, result.mOperationCount);
+
+        if (outputFormat == OutputFormat::CSV)
+        {
+            std::fprintf(outputFile, "%s,%zu,%zu,%zu,%d,%.6f,%.6f,%.3f\n", result.mName.c_str(), result.mEntityCount, result.mCoreCount, result.mOperationCount, result.mTrialCount, result.mBestMilliseconds, result.mMeanMilliseconds, bestNanosecondsPerOperation);
+        }
+        else
+        {
+            std::fprintf(outputFile, "    { \"name\": \"%s\", \"entities\": %zu, \"cores\": %zu, \"operations\": %zu, \"trials\": %d, \"best_ms\": %.6f, \"mean_ms\": %.6f, \"best_ns_per_op\": %.3f }%s\n", result.mName.c_str(), result.mEntityCount, result.mCoreCount, result.mOperationCount, result.mTrialCount, result.mBestMilliseconds, result.mMeanMilliseconds, bestNanosecondsPerOperation, i + 1U < results.size() ? "," : "");
+        }
+    }
+
+    if (outputFormat == OutputFormat::JSON)
+    {
+        std::fprintf(outputFile, "  ]\n}\n");
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool ParseOptions(const int argc, char** argv, BenchmarkOptions& options)
+{
+    for (auto i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const auto hasValue = i + 1 < argc;
+
+        if (argument == "--format" && hasValue)
+        {
+            const std::string format = argv[++i];
+            if (format != "json" && format != "csv")
+            {
+                return false;
+            }
+            options.mOutputFormat = format == "csv" ? OutputFormat::CSV : OutputFormat::JSON;
+        }
+        else if (argument == "--output" && hasValue)
+        {
+            options.mOutputPath = argv[++i];
+        }
+        else if (argument == "--filter" && hasValue)
+        {
+            options.mNameFilter = argv[++i];
+        }
+        else if (argument == "--trials" && hasValue)
+        {
+            options.mTrialCount = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (argument == "--max-entities" && hasValue)
+        {
+            options.mMaxEntityCount = static_cast<std::size_t>(std::max(1LL, std::atoll(argv[++i])));
+        }
+        else if (argument == "--max-cores" && hasValue)
+        {
+            options.mMaxCoreCount = static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+/// Runs the registered benchmarks headlessly and emits their results as JSON (default) or CSV, to be
+/// used as the regression baseline for storage and scheduling changes. Progress is reported on stderr.
+int main(int argc, char** argv)
+{
+    benchmarks::BenchmarkOptions options;
+    if (!benchmarks::ParseOptions(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: GenesisBench [--format json|csv] [--output <path>] [--filter <name substring>] [--trials <count>] [--max-entities <count>] [--max-cores <count>]\n");
+        return 1;
+    }
+
+    std::vector<benchmarks::BenchmarkCase> benchmarkCases;
+    benchmarks::RegisterEcsBenchmarks(benchmarkCases);
+    benchmarks::RegisterJobSystemBenchmarks(benchmarkCases, options.mMaxCoreCount);
+
+    std::vector<benchmarks::BenchmarkResult> results;
+    for (const auto& benchmarkCase: benchmarkCases)
+    {
+        if (benchmarkCase.mName.find(options.mNameFilter) == std::string::npos)
+        {
+            continue;
+        }
+
+        genesis::jobs::JobSystem::GetInstance().SetWorkerThreadCount(benchmarkCase.mWorkerThreadCount);
+        for (const auto entityCount: benchmarkCase.mEntityCounts)
+        {
+            if (entityCount > options.mMaxEntityCount)
+            {
+                continue;
+            }
+
+            std::fprintf(stderr, "Running %s (%zu entities, %zu cores)\n", benchmarkCase.mName.c_str(), entityCount, benchmarkCase.mWorkerThreadCount + 1U);
+            results.push_back(benchmarks::RunBenchmark(benchmarkCase, entityCount, options.mTrialCount));
+        }
+    }
+
+    auto* outputFile = options.mOutputPath.empty() ? stdout : std::fopen(options.mOutputPath.c_str(), "w");
+    if (outputFile == nullptr)
+    {
+        std::fprintf(stderr, "Could not open %s for writing\n", options.mOutputPath.c_str());
+        return 1;
+    }
+
+    benchmarks::WriteResults(results, options.mOutputFormat, outputFile);
+
+    if (outputFile != stdout)
+    {
+        std::fclose(outputFile);
+    }
+
+    return 0;
+}
+
+///------------------------------------------------------------------------------------------------
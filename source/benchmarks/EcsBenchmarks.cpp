@@ -0,0 +1,190 @@
+///------------------------------------------------------------------------------------------------
+///  EcsBenchmarks.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include "../engine/ECS.h"
+#include "../engine/common/components/TransformComponent.h"
+#include "../engine/common/utils/StringUtils.h"
+#include "../game/physics/components/PhysicsComponent.h"
+#include "../game/physics/systems/PhysicsMovementApplicationSystem.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+///------------------------------------------------------------------------------------------------
+
+namespace benchmarks
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const std::vector<std::size_t> ECS_BENCHMARK_ENTITY_COUNTS = { 1000U, 10000U, 100000U, 1000000U };
+
+    const int SYSTEM_ITERATION_FRAME_COUNT = 10;
+    const float BENCHMARK_FRAME_DT         = 1.0f/60.0f;
+    const unsigned int RANDOM_ACCESS_SEED  = 1337U;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<genesis::ecs::EntityId> CreateEntitiesWithTransforms(genesis::ecs::World& world, const std::size_t entityCount)
+{
+    std::vector<genesis::ecs::EntityId> entityIds(entityCount);
+    for (auto i = 0U; i < entityCount; ++i)
+    {
+        entityIds[i] = world.CreateEntity();
+        world.AddComponent<genesis::TransformComponent>(entityIds[i]).mPosition.x = static_cast<float>(i);
+    }
+
+    return entityIds;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<genesis::ecs::EntityId> ShuffleEntities(std::vector<genesis::ecs::EntityId> entityIds)
+{
+    std::shuffle(entityIds.begin(), entityIds.end(), std::mt19937(RANDOM_ACCESS_SEED));
+    return entityIds;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static BenchmarkMeasurement BenchmarkEntityCreation(const std::size_t entityCount)
+{
+    auto world = std::make_unique<genesis::ecs::World>();
+
+    const auto startTimePoint = std::chrono::steady_clock::now();
+    CreateEntitiesWithTransforms(*world, entityCount);
+    return MeasureSince(startTimePoint, entityCount);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static BenchmarkMeasurement BenchmarkEntityDestruction(const std::size_t entityCount)
+{
+    auto world = std::make_unique<genesis::ecs::World>();
+    const auto entityIds = CreateEntitiesWithTransforms(*world, entityCount);
+
+    // Destroyed entities are only reclaimed on the next update, which is part of their destruction cost
+    const auto startTimePoint = std::chrono::steady_clock::now();
+    world->DestroyEntities(entityIds);
+    world->Update(BENCHMARK_FRAME_DT);
+    return MeasureSince(startTimePoint, entityCount);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static BenchmarkMeasurement BenchmarkComponentChurn(const std::size_t entityCount)
+{
+    auto world = std::make_unique<genesis::ecs::World>();
+    const auto entityIds = CreateEntitiesWithTransforms(*world, entityCount);
+
+    // Each operation moves an entity to another archetype and back
+    const auto startTimePoint = std::chrono::steady_clock::now();
+    for (const auto entityId: entityIds)
+    {
+        world->AddComponent<physics::PhysicsComponent>(entityId);
+    }
+    for (const auto entityId: entityIds)
+    {
+        world->RemoveComponent<physics::PhysicsComponent>(entityId);
+    }
+    return MeasureSince(startTimePoint, 2U * entityCount);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static BenchmarkMeasurement BenchmarkRandomComponentAccess(const std::size_t entityCount)
+{
+    auto world = std::make_unique<genesis::ecs::World>();
+    const auto entityIds = ShuffleEntities(CreateEntitiesWithTransforms(*world, entityCount));
+
+    auto positionSum = 0.0f;
+    const auto startTimePoint = std::chrono::steady_clock::now();
+    for (const auto entityId: entityIds)
+    {
+        positionSum += world->GetComponent<genesis::TransformComponent>(entityId).mPosition.x;
+    }
+    const auto measurement = MeasureSince(startTimePoint, entityCount);
+
+    ConsumeValue(positionSum);
+    return measurement;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static BenchmarkMeasurement BenchmarkSystemIteration(const std::size_t entityCount)
+{
+    auto world = std::make_unique<genesis::ecs::World>();
+    for (const auto entityId: CreateEntitiesWithTransforms(*world, entityCount))
+    {
+        auto& physicsComponent = world->AddComponent<physics::PhysicsComponent>(entityId);
+        physicsComponent.mDirection       = glm::vec3(1.0f, 0.0f, 0.0f);
+        physicsComponent.mVelocitySpeed   = 0.5f;
+        physicsComponent.mRotationalSpeed = 1.0f;
+    }
+    world->AddSystem(std::make_unique<physics::PhysicsMovementApplicationSystem>(*world));
+
+    // Settle any pending structural changes before measuring
+    world->Update(BENCHMARK_FRAME_DT);
+
+    const auto startTimePoint = std::chrono::steady_clock::now();
+    for (auto i = 0; i < SYSTEM_ITERATION_FRAME_COUNT; ++i)
+    {
+        world->Update(BENCHMARK_FRAME_DT);
+    }
+    return MeasureSince(startTimePoint, SYSTEM_ITERATION_FRAME_COUNT * entityCount);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static BenchmarkMeasurement BenchmarkNameLookup(const std::size_t entityCount)
+{
+    auto world = std::make_unique<genesis::ecs::World>();
+
+    std::vector<StringId> entityNames;
+    entityNames.reserve(entityCount);
+    for (auto i = 0U; i < entityCount; ++i)
+    {
+        entityNames.emplace_back("entity_" + std::to_string(i));
+        world->CreateEntity(entityNames.back());
+    }
+    std::shuffle(entityNames.begin(), entityNames.end(), std::mt19937(RANDOM_ACCESS_SEED));
+
+    auto foundEntityCount = 0.0f;
+    const auto startTimePoint = std::chrono::steady_clock::now();
+    for (const auto& entityName: entityNames)
+    {
+        foundEntityCount += world->FindEntityWithName(entityName) != genesis::ecs::NULL_ENTITY_ID ? 1.0f : 0.0f;
+    }
+    const auto measurement = MeasureSince(startTimePoint, entityCount);
+
+    ConsumeValue(foundEntityCount);
+    return measurement;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void RegisterEcsBenchmarks(std::vector<BenchmarkCase>& benchmarkCases)
+{
+    // All ECS benchmarks run single threaded, so that they measure the storage rather than the scheduling
+    benchmarkCases.push_back({ "entity_create", ECS_BENCHMARK_ENTITY_COUNTS, 0U, BenchmarkEntityCreation });
+    benchmarkCases.push_back({ "entity_destroy", ECS_BENCHMARK_ENTITY_COUNTS, 0U, BenchmarkEntityDestruction });
+    benchmarkCases.push_back({ "component_add_remove", ECS_BENCHMARK_ENTITY_COUNTS, 0U, BenchmarkComponentChurn });
+    benchmarkCases.push_back({ "get_component_random", ECS_BENCHMARK_ENTITY_COUNTS, 0U, BenchmarkRandomComponentAccess });
+    benchmarkCases.push_back({ "system_iteration", ECS_BENCHMARK_ENTITY_COUNTS, 0U, BenchmarkSystemIteration });
+    benchmarkCases.push_back({ "name_lookup", ECS_BENCHMARK_ENTITY_COUNTS, 0U, BenchmarkNameLookup });
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
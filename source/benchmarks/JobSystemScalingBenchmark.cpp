@@ -0,0 +1,87 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystemScalingBenchmark.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include "../engine/ECS.h"
+#include "../engine/common/components/TransformComponent.h"
+#include "../game/physics/components/PhysicsComponent.h"
+#include "../game/physics/systems/PhysicsMovementApplicationSystem.h"
+
+#include <memory>
+
+///------------------------------------------------------------------------------------------------
+
+namespace benchmarks
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const std::size_t BENCHMARK_ENTITY_COUNT = 100000U;
+    const int BENCHMARK_WARMUP_FRAMES        = 10;
+    const int BENCHMARK_MEASURED_FRAMES      = 200;
+    const float BENCHMARK_FRAME_DT           = 1.0f/60.0f;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void CreateBenchmarkEntities(genesis::ecs::World& world, const std::size_t entityCount)
+{
+    for (auto i = 0U; i < entityCount; ++i)
+    {
+        const auto entityId = world.CreateEntity();
+
+        auto& transformComponent = world.AddComponent<genesis::TransformComponent>(entityId);
+        transformComponent.mPosition = glm::vec3(static_cast<float>(i % 100), static_cast<float>(i / 100), 0.0f);
+
+        auto& physicsComponent = world.AddComponent<physics::PhysicsComponent>(entityId);
+        physicsComponent.mDirection = glm::vec3(1.0f, static_cast<float>(i % 7), 0.0f);
+        physicsComponent.mCollidableDimensions = glm::vec3(1.0f);
+        physicsComponent.mVelocitySpeed = 0.5f;
+        physicsComponent.mRotationalSpeed = 1.0f;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static BenchmarkMeasurement BenchmarkPhysicsMovementScaling(const std::size_t entityCount)
+{
+    auto world = std::make_unique<genesis::ecs::World>();
+    CreateBenchmarkEntities(*world, entityCount);
+    world->AddSystem(std::make_unique<physics::PhysicsMovementApplicationSystem>(*world));
+
+    for (auto i = 0; i < BENCHMARK_WARMUP_FRAMES; ++i)
+    {
+        world->Update(BENCHMARK_FRAME_DT);
+    }
+
+    const auto startTimePoint = std::chrono::steady_clock::now();
+    for (auto i = 0; i < BENCHMARK_MEASURED_FRAMES; ++i)
+    {
+        world->Update(BENCHMARK_FRAME_DT);
+    }
+    return MeasureSince(startTimePoint, BENCHMARK_MEASURED_FRAMES);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void RegisterJobSystemBenchmarks(std::vector<BenchmarkCase>& benchmarkCases, const std::size_t maxCoreCount)
+{
+    // Measures the PhysicsMovementApplicationSystem update time over 100k entities, while scaling the job system
+    // from 1 core (no worker threads) up to N cores (N - 1 worker threads plus the main thread). Each operation is a frame.
+    for (auto coreCount = 1U; coreCount <= maxCoreCount; ++coreCount)
+    {
+        benchmarkCases.push_back({ "job_system_scaling", { BENCHMARK_ENTITY_COUNT }, coreCount - 1U, BenchmarkPhysicsMovementScaling });
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
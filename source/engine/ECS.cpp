@@ -7,10 +7,15 @@
 
 #include "ECS.h"
 #include "common/components/NameComponent.h"
+#include "profiling/Profiler.h"
 
-#include <chrono>
+#include <cstdlib>
 #include <typeinfo>
 
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
 ///------------------------------------------------------------------------------------------------
 
 namespace genesis
@@ -23,14 +28,370 @@ namespace ecs
 
 ///------------------------------------------------------------------------------------------------
 
-#if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
-static StringId GetSystemNameFromTypeIdString(const std::string& typeIdString)
+std::atomic<ComponentTypeId> ComponentTypeIdRegistry::sNextComponentTypeId(0);
+
+///------------------------------------------------------------------------------------------------
+
+static StringId GetSystemNameFromTypeIdString(std::string typeIdString)
 {
+#if defined(__GNUG__)
+    // GCC and Clang report mangled type names
+    auto demangleStatus = 0;
+    std::unique_ptr<char, void(*)(void*)> demangledTypeName(abi::__cxa_demangle(typeIdString.c_str(), nullptr, nullptr, &demangleStatus), std::free);
+    if (demangleStatus == 0)
+    {
+        typeIdString = demangledTypeName.get();
+    }
+#endif
+    
     const auto& systemNameSplitByWhiteSpace = StringSplit(typeIdString, ' ');
     const auto& systemNameSplitByColumn = StringSplit(systemNameSplitByWhiteSpace[systemNameSplitByWhiteSpace.size() - 1], ':');
     return StringId(systemNameSplitByColumn[systemNameSplitByColumn.size() - 1]);
 }
-#endif
+
+///------------------------------------------------------------------------------------------------
+
+DeferredComponentDestructionQueue::Batch::Batch()
+    : mArena(DEFERRED_DESTRUCTION_ARENA_BLOCK_SIZE)
+    , mDestroyedComponentCount(0U)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+DeferredComponentDestructionQueue::DeferredComponentDestructionQueue()
+    : mFillingBatchIndex(0U)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+DeferredComponentDestructionQueue::~DeferredComponentDestructionQueue()
+{
+    for (auto& batch: mBatches)
+    {
+        for (auto componentIndex = batch.mDestroyedComponentCount; componentIndex < batch.mComponents.size(); ++componentIndex)
+        {
+            batch.mComponents[componentIndex].first->Destroy(batch.mComponents[componentIndex].second);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void DeferredComponentDestructionQueue::Enqueue(const ComponentTypeInfo& typeInfo, void* component)
+{
+    auto& batch = mBatches[mFillingBatchIndex];
+    auto* queuedComponent = batch.mArena.Allocate(typeInfo.mSize, typeInfo.mAlignment);
+
+    typeInfo.Relocate(queuedComponent, component);
+    batch.mComponents.emplace_back(&typeInfo, queuedComponent);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void DeferredComponentDestructionQueue::DestroyQueuedComponents(const std::size_t maxComponentCount)
+{
+    auto* drainingBatch = &mBatches[1 - mFillingBatchIndex];
+    if (drainingBatch->mDestroyedComponentCount == drainingBatch->mComponents.size())
+    {
+        drainingBatch->mArena.Reset();
+        drainingBatch->mComponents.clear();
+        drainingBatch->mDestroyedComponentCount = 0U;
+
+        // The filling batch only starts draining once the previous one is done, so the arenas are never reset with live components
+        drainingBatch = &mBatches[mFillingBatchIndex];
+        mFillingBatchIndex = 1 - mFillingBatchIndex;
+    }
+
+    const auto lastComponentIndex = drainingBatch->mDestroyedComponentCount + std::min(maxComponentCount, drainingBatch->mComponents.size() - drainingBatch->mDestroyedComponentCount);
+    for (auto componentIndex = drainingBatch->mDestroyedComponentCount; componentIndex < lastComponentIndex; ++componentIndex)
+    {
+        drainingBatch->mComponents[componentIndex].first->Destroy(drainingBatch->mComponents[componentIndex].second);
+    }
+
+    drainingBatch->mDestroyedComponentCount = lastComponentIndex;
+}
+
+///------------------------------------------------------------------------------------------------
+
+ComponentChunkPool::ComponentChunkPool(const ComponentTypeInfo& typeInfo)
+    : mTypeInfo(&typeInfo)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+ComponentChunkPool::~ComponentChunkPool()
+{
+    for (auto* chunk: mFreeChunks)
+    {
+        ::operator delete(chunk, std::align_val_t(mTypeInfo->mAlignment));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+unsigned char* ComponentChunkPool::AllocateChunk()
+{
+    if (mFreeChunks.empty())
+    {
+        return static_cast<unsigned char*>(::operator new(mTypeInfo->mSize * ARCHETYPE_CHUNK_CAPACITY, std::align_val_t(mTypeInfo->mAlignment)));
+    }
+    
+    auto* chunk = mFreeChunks.back();
+    mFreeChunks.pop_back();
+    return chunk;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ComponentChunkPool::ReleaseChunk(unsigned char* chunk)
+{
+    mFreeChunks.push_back(chunk);
+}
+
+///------------------------------------------------------------------------------------------------
+
+ComponentColumn::ComponentColumn(ComponentChunkPool& chunkPool)
+    : mChunkPool(&chunkPool)
+    , mTypeInfo(&chunkPool.GetTypeInfo())
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+ComponentColumn::~ComponentColumn()
+{
+    for (auto* chunk: mChunks)
+    {
+        mChunkPool->ReleaseChunk(chunk);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ComponentColumn::AddChunk()
+{
+    mChunks.push_back(mChunkPool->AllocateChunk());
+    mChangeTicks.resize(mChunks.size() * ARCHETYPE_CHUNK_CAPACITY);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ComponentColumn::RemoveChunk()
+{
+    mChunkPool->ReleaseChunk(mChunks.back());
+    mChunks.pop_back();
+    mChangeTicks.resize(mChunks.size() * ARCHETYPE_CHUNK_CAPACITY);
+}
+
+///------------------------------------------------------------------------------------------------
+
+Archetype::Archetype(const ComponentMask& componentMask, const std::vector<std::unique_ptr<ComponentChunkPool>>& componentChunkPools)
+    : mComponentMask(componentMask)
+    , mColumnIndices(componentChunkPools.size(), -1)
+    , mRowCapacity(0U)
+{
+    for (auto componentTypeId = 0; componentTypeId < static_cast<ComponentTypeId>(componentChunkPools.size()); ++componentTypeId)
+    {
+        if (mComponentMask[componentTypeId])
+        {
+            assert(componentChunkPools[componentTypeId] != nullptr &&
+                "Archetype created with an unregistered component type");
+
+            mColumnIndices[componentTypeId] = static_cast<int>(mColumns.size());
+            mColumns.emplace_back(*componentChunkPools[componentTypeId]);
+            mColumnComponentTypeIds.push_back(componentTypeId);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+Archetype::~Archetype()
+{
+    Clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::size_t Archetype::AllocateRow(const EntityId entityId)
+{
+    if (mEntities.size() == mRowCapacity)
+    {
+        for (auto& column: mColumns)
+        {
+            column.AddChunk();
+        }
+        
+        mRowCapacity += ARCHETYPE_CHUNK_CAPACITY;
+    }
+    
+    mEntities.push_back(entityId);
+    return mEntities.size() - 1;
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityId Archetype::FreeRow(const std::size_t row)
+{
+    const auto lastRow = mEntities.size() - 1;
+    auto relocatedEntityId = NULL_ENTITY_ID;
+    
+    if (row != lastRow)
+    {
+        for (auto& column: mColumns)
+        {
+            column.GetTypeInfo().Relocate(column.GetComponentAddress(row), column.GetComponentAddress(lastRow));
+            *column.GetChangeTickAddress(row) = *column.GetChangeTickAddress(lastRow);
+        }
+        
+        mEntities[row] = mEntities[lastRow];
+        relocatedEntityId = mEntities[row];
+    }
+    
+    mEntities.pop_back();
+    
+    // A whole spare chunk is kept around, so that entities moving back and forth
+    // across a chunk boundary do not keep releasing and reacquiring chunks
+    if (mRowCapacity - mEntities.size() >= 2 * ARCHETYPE_CHUNK_CAPACITY)
+    {
+        for (auto& column: mColumns)
+        {
+            column.RemoveChunk();
+        }
+        
+        mRowCapacity -= ARCHETYPE_CHUNK_CAPACITY;
+    }
+    
+    return relocatedEntityId;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Archetype::Clear()
+{
+    for (auto& column: mColumns)
+    {
+        const auto& typeInfo = column.GetTypeInfo();
+        if (typeInfo.mIsTriviallyCopyable)
+        {
+            continue;
+        }
+        
+        for (auto row = 0U; row < mEntities.size(); ++row)
+        {
+            typeInfo.Destroy(column.GetComponentAddress(row));
+        }
+    }
+    
+    mEntities.clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityCommandBuffer::EntityCommandBuffer()
+    : mComponentArena(COMMAND_BUFFER_ARENA_BLOCK_SIZE)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityCommandBuffer::~EntityCommandBuffer()
+{
+    // Components of commands that were never played back still need to be destroyed
+    for (auto& command: mCommands)
+    {
+        if (command.mComponent != nullptr)
+        {
+            command.mComponentTypeInfo->Destroy(command.mComponent);
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityId EntityCommandBuffer::CreateEntity()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    
+    // Temporary ids are negative, so that they can never collide with actual entity ids
+    const auto pendingEntityId = -static_cast<EntityId>(++mPendingEntityCount);
+    mCommands.push_back(Command{ CommandType::CREATE_ENTITY, pendingEntityId, nullptr, nullptr, nullptr });
+    
+    return pendingEntityId;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityCommandBuffer::DestroyEntity(const EntityId entityId)
+{
+    RecordCommand(Command{ CommandType::DESTROY_ENTITY, entityId, nullptr, nullptr, nullptr });
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool EntityCommandBuffer::IsEmpty() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mCommands.empty();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityCommandBuffer::Playback(World& world)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mCommands.empty())
+    {
+        return;
+    }
+    
+    std::vector<EntityId> createdEntityIds(mPendingEntityCount, NULL_ENTITY_ID);
+    
+    for (auto& command: mCommands)
+    {
+        if (command.mType == CommandType::CREATE_ENTITY)
+        {
+            createdEntityIds[static_cast<std::size_t>(-command.mEntityId) - 1] = world.CreateEntity();
+            continue;
+        }
+        
+        assert(static_cast<std::size_t>(-std::min(command.mEntityId, 0LL)) <= mPendingEntityCount &&
+            "Temporary entity id does not belong to this command buffer");
+        
+        const auto entityId = command.mEntityId < 0 ? createdEntityIds[static_cast<std::size_t>(-command.mEntityId) - 1] : command.mEntityId;
+        if (world.HasEntity(entityId))
+        {
+            switch (command.mType)
+            {
+                case CommandType::DESTROY_ENTITY: world.DestroyEntity(entityId); break;
+                case CommandType::ADD_COMPONENT:
+                case CommandType::REMOVE_COMPONENT: command.mComponentCommandFunction(world, entityId, command.mComponent); break;
+                case CommandType::CREATE_ENTITY: break;
+            }
+        }
+        
+        // The arena copy has either been moved into the world, or its addition has been skipped
+        if (command.mComponent != nullptr)
+        {
+            command.mComponentTypeInfo->Destroy(command.mComponent);
+        }
+    }
+    
+    mCommands.clear();
+    mPendingEntityCount = 0U;
+    mComponentArena.Reset();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityCommandBuffer::RecordCommand(Command command)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCommands.push_back(std::move(command));
+}
 
 ///------------------------------------------------------------------------------------------------
 
@@ -42,9 +403,15 @@ World& World::GetInstance()
 
 ///------------------------------------------------------------------------------------------------
 
-const tsl::robin_map<StringId, long long, StringIdHasher>& World::GetSystemUpdateTimes() const
+std::vector<StringId> World::GetSystemNames() const
 {
-    return mSystemUpdateToDuration;
+    std::vector<StringId> systemNames;
+    for (const auto& system: mSystems)
+    {
+        systemNames.push_back(system->mSystemName);
+    }
+    
+    return systemNames;
 }
 
 
@@ -52,62 +419,163 @@ const tsl::robin_map<StringId, long long, StringIdHasher>& World::GetSystemUpdat
 
 void World::AddSystem(std::unique_ptr<ISystem> system)
 {
+    assert(&system->mWorld == this &&
+        "System was constructed for a different world");
+
     auto& systemRef = *system;
-    
-#if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
+
     system->mSystemName = GetSystemNameFromTypeIdString(std::string(typeid(systemRef).name()));
-#endif
+    system->mProfileScopeName = profiling::Profiler::GetInstance().InternScopeName(system->mSystemName.GetString());
+
+    // Existing entities that match the new system's signature are processed right away
+    EntitySparseSet systemEntities;
+    for (const auto& archetype: mArchetypes)
+    {
+        if (systemRef.ShouldProcessComponentMask(archetype->GetComponentMask()))
+        {
+            for (const auto& entityId: archetype->GetEntities())
+            {
+                systemEntities.Insert(entityId);
+            }
+        }
+    }
 
     mSystems.push_back(std::move(system));
-    mEntitiesToUpdatePerSystem[typeid(systemRef)];
+    mEntitiesToUpdatePerSystem.push_back(std::move(systemEntities));
+    
+    RebuildSystemUpdateStages();
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void World::Update(const float dt)
+void World::Update(const float dt, const SystemUpdatePhase updatePhase /* SystemUpdatePhase::SIMULATION */)
 {
-    RemoveEntitiesWithoutAnyComponents();
+    GENESIS_PROFILE_SCOPE("World::Update");
     
-    for(const auto& system: mSystems)
-    {     
-#if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
-        const auto& start = std::chrono::high_resolution_clock::now();
-#endif
-        auto& systemRef = *system;
-        const auto& entityVec = mEntitiesToUpdatePerSystem.at(typeid(systemRef));
+    // Structural changes made outside of the world update (e.g. during game initialization) are observed first
+    DispatchPendingObserverEvents();
+    
+    ProcessPendingEntityChanges();
+    ReclaimDestroyedEntities();
+    mDeferredComponentDestructionQueue.DestroyQueuedComponents(MAX_DEFERRED_COMPONENT_DESTRUCTIONS_PER_UPDATE);
+    
+    auto& jobSystem = jobs::JobSystem::GetInstance();
+    
+    for (const auto& systemUpdateStage: mSystemUpdateStages[static_cast<std::size_t>(updatePhase)])
+    {
+        // Structural changes made by the previous stages become visible here
+        ProcessPendingEntityChanges();
         
-        system->VUpdate(dt, entityVec);
-
-#if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)        
-        const auto& end = std::chrono::high_resolution_clock::now();
-        const auto& duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-        mSystemUpdateToDuration[StringId(system->mSystemName)] = duration.count();
-#endif
+        // Each stage gets its own tick, so that its systems see all changes made before it (but not their own)
+        ++mChangeTick;
+        
+        if (systemUpdateStage.size() == 1)
+        {
+            UpdateSystem(systemUpdateStage.front(), dt);
+            
+            ++mChangeTick;
+            mSystems[systemUpdateStage.front()]->mCommandBuffer.Playback(*this);
+            DispatchPendingObserverEvents();
+            continue;
+        }
+        
+        // Systems of the same stage access disjoint data, so the order they complete in does not matter
+        jobs::JobCounter stageCounter;
+        for (const auto systemIndex: systemUpdateStage)
+        {
+            if (mSystems[systemIndex]->mIsPinnedToMainThread == false)
+            {
+                jobSystem.ScheduleJob([this, systemIndex, dt]() { UpdateSystem(systemIndex, dt); }, stageCounter);
+            }
+        }
+        
+        for (const auto systemIndex: systemUpdateStage)
+        {
+            if (mSystems[systemIndex]->mIsPinnedToMainThread)
+            {
+                UpdateSystem(systemIndex, dt);
+            }
+        }
+        
+        jobSystem.WaitForCounter(stageCounter);
+        
+        // Structural changes recorded by the stage's systems are applied in system order, keeping the outcome deterministic.
+        // They get a newer tick than the stage's, so the systems that recorded them see them as changes on their next update
+        ++mChangeTick;
+        for (const auto systemIndex: systemUpdateStage)
+        {
+            mSystems[systemIndex]->mCommandBuffer.Playback(*this);
+        }
+        
+        DispatchPendingObserverEvents();
     }
+    
+    DispatchChangeObserverEvents();
 }
 
 ///------------------------------------------------------------------------------------------------
 
-EntityId World::CreateEntity()
+void World::RemoveObserver(const ObserverId observerId)
 {
-    mEntityComponentStore.operator[](mEntityCounter);
-    return mEntityCounter++;
+    auto observerIter = std::find_if(mObservers.begin(), mObservers.end(), [observerId](const std::unique_ptr<Observer>& observer)
+    {
+        return observer->mId == observerId;
+    });
+    
+    assert(observerId != NULL_OBSERVER_ID && observerIter != mObservers.end() &&
+        "Observer does not exist in the world");
+    
+    // Observers may be removed while being iterated, so they are only marked here and discarded once no dispatch is in flight
+    const auto eventType = (*observerIter)->mEventType;
+    const auto componentTypeId = (*observerIter)->mComponentTypeId;
+    (*observerIter)->mId = NULL_OBSERVER_ID;
+    mHasRemovedObservers = true;
+    
+    const auto hasRemainingObservers = std::any_of(mObservers.cbegin(), mObservers.cend(), [eventType, componentTypeId](const std::unique_ptr<Observer>& observer)
+    {
+        return observer->mId != NULL_OBSERVER_ID && observer->mEventType == eventType && observer->mComponentTypeId == componentTypeId;
+    });
+    
+    if (hasRemainingObservers == false)
+    {
+        GetObservedComponentMask(eventType).Reset(componentTypeId);
+    }
+    
+    CompactObservers();
 }
 
 ///------------------------------------------------------------------------------------------------
 
-EntityId World::CreateEntity(const StringId& name)
+EntityId World::CreateEntity()
 {
-    const auto entity = CreateEntity();    
-    AddComponent<NameComponent>(entity, std::make_unique<NameComponent>(name));
-    return entity;
+    EntityIndex entityIndex = 0U;
+    if (mFreeEntityIndices.empty())
+    {
+        entityIndex = static_cast<EntityIndex>(mEntityRecords.size());
+        mEntityRecords.emplace_back();
+    }
+    else
+    {
+        entityIndex = mFreeEntityIndices.back();
+        mFreeEntityIndices.pop_back();
+    }
+    
+    auto& entityRecord = mEntityRecords[entityIndex];
+    const auto entityId = MakeEntityId(entityIndex, entityRecord.mGeneration);
+    
+    entityRecord.mArchetype = mEmptyArchetype;
+    entityRecord.mRow = mEmptyArchetype->AllocateRow(entityId);
+    
+    return entityId;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-bool World::HasEntity(const EntityId entityId) const
+EntityId World::CreateEntity(const StringId& name)
 {
-    return mEntityComponentStore.count(entityId) != 0;
+    const auto entity = CreateEntity();    
+    AddComponent<NameComponent>(entity, name);
+    return entity;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -117,11 +585,22 @@ void World::DestroyEntity(const EntityId entityId)
     assert(entityId != NULL_ENTITY_ID &&
         "NULL_ENTITY_ID entity removal request");
 
-    assert(mEntityComponentStore.count(entityId) != 0 &&
+    assert(HasEntity(entityId) &&
         "Entity does not exist in the world");
 
-    mEntityComponentStore.at(entityId).mMask.reset();
-    OnEntityChanged(entityId, ComponentMask());
+    auto& entityRecord = mEntityRecords[GetEntityIndex(entityId)];
+    if (entityRecord.mArchetype != mEmptyArchetype)
+    {
+        MoveEntityToArchetype(entityId, entityRecord, *mEmptyArchetype, true);
+    }
+    
+    if (entityRecord.mIsPendingReclamation == false)
+    {
+        entityRecord.mIsPendingReclamation = true;
+        mEntitiesPendingReclamation.push_back(entityId);
+    }
+    
+    OnEntityChanged(entityId);
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -138,94 +617,405 @@ void World::DestroyEntities(const std::vector<EntityId>& entityIds)
 
 EntityId World::FindEntityWithName(const StringId& entityName) const
 {
-    for (const auto& entityComponentStoreEntry: mEntityComponentStore)
+    const auto& entityIds = GetComponentIndex<NameComponent, StringId, StringIdHasher>().Find(entityName);
+    return entityIds.empty() ? NULL_ENTITY_ID : entityIds.front();
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::vector<EntityId> World::FindAllEntitiesWithName(const StringId &entityName) const
+{
+    return GetComponentIndex<NameComponent, StringId, StringIdHasher>().Find(entityName);
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::size_t World::GetEntityCount() const
+{
+    return mEntityRecords.size() - mFreeEntityIndices.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::RebuildSystemUpdateStages()
+{
+    std::vector<std::size_t> systemStageIndices(mSystems.size(), 0U);
+    for (auto& phaseUpdateStages: mSystemUpdateStages)
+    {
+        phaseUpdateStages.clear();
+    }
+    
+    for (auto systemIndex = 0U; systemIndex < mSystems.size(); ++systemIndex)
     {
-        const auto& entityId = entityComponentStoreEntry.first;
-        if (HasComponent<NameComponent>(entityId) && GetComponent<NameComponent>(entityId).mName == entityName)
+        const auto updatePhase = mSystems[systemIndex]->mUpdatePhase;
+        for (auto previousSystemIndex = 0U; previousSystemIndex < systemIndex; ++previousSystemIndex)
+        {
+            // Systems of different phases are never updated together
+            if (mSystems[previousSystemIndex]->mUpdatePhase == updatePhase && mSystems[systemIndex]->ConflictsWith(*mSystems[previousSystemIndex]))
+            {
+                systemStageIndices[systemIndex] = std::max(systemStageIndices[systemIndex], systemStageIndices[previousSystemIndex] + 1);
+            }
+        }
+        
+        auto& phaseUpdateStages = mSystemUpdateStages[static_cast<std::size_t>(updatePhase)];
+        if (systemStageIndices[systemIndex] == phaseUpdateStages.size())
         {
-            return entityId;
+            phaseUpdateStages.emplace_back();
         }
+        
+        phaseUpdateStages[systemStageIndices[systemIndex]].push_back(systemIndex);
     }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::UpdateSystem(const std::size_t systemIndex, const float dt)
+{
+    GENESIS_PROFILE_SCOPE(mSystems[systemIndex]->mProfileScopeName);
     
-    return ecs::NULL_ENTITY_ID;
+    mSystems[systemIndex]->VUpdate(dt, mEntitiesToUpdatePerSystem[systemIndex].GetEntities());
+    mSystems[systemIndex]->mLastUpdateTick = mChangeTick;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-std::vector<EntityId> World::FindAllEntitiesWithName(const StringId &entityName) const
+void World::ReclaimDestroyedEntities()
 {
-    std::vector<EntityId> mEntityIds;
+    // Only the destroyed entities are visited, so frames without destructions cost nothing here
+    for (const auto& entityId: mEntitiesPendingReclamation)
+    {
+        const auto entityIndex = GetEntityIndex(entityId);
+        auto& entityRecord = mEntityRecords[entityIndex];
+        entityRecord.mIsPendingReclamation = false;
+        
+        if (entityRecord.mArchetype != mEmptyArchetype)
+        {
+            continue;
+        }
+        
+        const auto relocatedEntityId = mEmptyArchetype->FreeRow(entityRecord.mRow);
+        if (relocatedEntityId != NULL_ENTITY_ID)
+        {
+            mEntityRecords[GetEntityIndex(relocatedEntityId)].mRow = entityRecord.mRow;
+        }
+        
+        // Bumping the generation invalidates all outstanding ids of this slot (0 is skipped on wrap-around)
+        entityRecord.mArchetype = nullptr;
+        entityRecord.mGeneration = entityRecord.mGeneration == MAX_ENTITY_GENERATION ? INITIAL_ENTITY_GENERATION : entityRecord.mGeneration + 1;
+        
+        mFreeEntityIndices.push_back(entityIndex);
+    }
     
-    for (const auto& entityComponentStoreEntry: mEntityComponentStore)
+    mEntitiesPendingReclamation.clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::OnEntityChanged(const EntityId entityId)
+{
+    auto& entityRecord = mEntityRecords[GetEntityIndex(entityId)];
+    if (entityRecord.mHasPendingChanges == false)
+    {
+        entityRecord.mHasPendingChanges = true;
+        mPendingEntityChanges.push_back(entityId);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::ProcessPendingEntityChanges()
+{
+    for (const auto& entityId: mPendingEntityChanges)
     {
-        const auto& entityId = entityComponentStoreEntry.first;
-        if (HasComponent<NameComponent>(entityId) && GetComponent<NameComponent>(entityId).mName == entityName)
+        auto& entityRecord = mEntityRecords[GetEntityIndex(entityId)];
+        entityRecord.mHasPendingChanges = false;
+        
+        const auto& componentMask = entityRecord.mArchetype->GetComponentMask();
+        for (auto systemIndex = 0U; systemIndex < mSystems.size(); ++systemIndex)
         {
-            mEntityIds.push_back(entityId);
+            if (mSystems[systemIndex]->ShouldProcessComponentMask(componentMask))
+            {
+                mEntitiesToUpdatePerSystem[systemIndex].Insert(entityId);
+            }
+            else
+            {
+                mEntitiesToUpdatePerSystem[systemIndex].Erase(entityId);
+            }
         }
     }
     
-    return mEntityIds;
+    mPendingEntityChanges.clear();
 }
 
 ///------------------------------------------------------------------------------------------------
 
-std::size_t World::GetEntityCount() const
+Archetype& World::GetOrCreateArchetype(const ComponentMask& componentMask)
 {
-    return mEntityComponentStore.size();
+    auto archetypeIter = mArchetypesByMask.find(componentMask);
+    if (archetypeIter != mArchetypesByMask.end())
+    {
+        return *archetypeIter->second;
+    }
+    
+    mArchetypes.push_back(std::make_unique<Archetype>(componentMask, mComponentChunkPools));
+    mArchetypesByMask[componentMask] = mArchetypes.back().get();
+    
+    return *mArchetypes.back();
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void World::RemoveEntitiesWithoutAnyComponents()
+Archetype& World::GetArchetypeWithAddedComponent(Archetype& archetype, const ComponentTypeId componentTypeId)
 {
-    auto entityIter = mEntityComponentStore.begin();
-    while (entityIter != mEntityComponentStore.end())
-    {                
-        if (entityIter->second.mMask.any() == false)
+    auto transitionIter = archetype.mAddComponentTransitions.find(componentTypeId);
+    if (transitionIter != archetype.mAddComponentTransitions.end())
+    {
+        return *transitionIter->second;
+    }
+    
+    auto targetMask = archetype.GetComponentMask();
+    targetMask.Set(componentTypeId);
+    
+    auto& targetArchetype = GetOrCreateArchetype(targetMask);
+    archetype.mAddComponentTransitions[componentTypeId] = &targetArchetype;
+    targetArchetype.mRemoveComponentTransitions[componentTypeId] = &archetype;
+    
+    return targetArchetype;
+}
+
+///------------------------------------------------------------------------------------------------
+
+Archetype& World::GetArchetypeWithRemovedComponent(Archetype& archetype, const ComponentTypeId componentTypeId)
+{
+    auto transitionIter = archetype.mRemoveComponentTransitions.find(componentTypeId);
+    if (transitionIter != archetype.mRemoveComponentTransitions.end())
+    {
+        return *transitionIter->second;
+    }
+    
+    auto targetMask = archetype.GetComponentMask();
+    targetMask.Reset(componentTypeId);
+    
+    auto& targetArchetype = GetOrCreateArchetype(targetMask);
+    archetype.mRemoveComponentTransitions[componentTypeId] = &targetArchetype;
+    targetArchetype.mAddComponentTransitions[componentTypeId] = &archetype;
+    
+    return targetArchetype;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::size_t World::MoveEntityToArchetype(const EntityId entityId, EntityRecord& entityRecord, Archetype& targetArchetype, const bool deferComponentDestruction /* false */)
+{
+    const auto targetRow = targetArchetype.AllocateRow(entityId);
+    MoveEntityToArchetypeRow(entityId, entityRecord, targetArchetype, targetRow, deferComponentDestruction);
+    return targetRow;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::MoveEntityToArchetypeRow(const EntityId entityId, EntityRecord& entityRecord, Archetype& targetArchetype, const std::size_t targetRow, const bool deferComponentDestruction /* false */)
+{
+    auto& sourceArchetype = *entityRecord.mArchetype;
+    const auto sourceRow  = entityRecord.mRow;
+    
+    for (auto columnIndex = 0U; columnIndex < sourceArchetype.mColumns.size(); ++columnIndex)
+    {
+        const auto componentTypeId = sourceArchetype.mColumnComponentTypeIds[columnIndex];
+        const auto& typeInfo = sourceArchetype.mColumns[columnIndex].GetTypeInfo();
+        auto* sourceComponent = sourceArchetype.mColumns[columnIndex].GetComponentAddress(sourceRow);
+        
+        if (targetArchetype.GetComponentMask()[componentTypeId])
         {
-            entityIter = mEntityComponentStore.erase(entityIter);
+            typeInfo.Relocate(targetArchetype.GetComponentAddress(componentTypeId, targetRow), sourceComponent);
+            *targetArchetype.GetChangeTickAddress(componentTypeId, targetRow) = *sourceArchetype.mColumns[columnIndex].GetChangeTickAddress(sourceRow);
         }
         else
         {
-            entityIter++;
+            if (mIndexedComponentMask[componentTypeId])
+            {
+                mComponentIndices[componentTypeId]->VOnComponentRemoved(entityId, sourceComponent);
+            }
+
+            QueueObserverEvent(ObserverEventType::REMOVE, componentTypeId, entityId);
+            
+            // Trivially copyable components have nothing to destroy, so there is no point in queueing them
+            if (deferComponentDestruction && typeInfo.mIsTriviallyCopyable == false)
+            {
+                mDeferredComponentDestructionQueue.Enqueue(typeInfo, sourceComponent);
+            }
+            else
+            {
+                typeInfo.Destroy(sourceComponent);
+            }
         }
     }
+    
+    const auto relocatedEntityId = sourceArchetype.FreeRow(sourceRow);
+    if (relocatedEntityId != NULL_ENTITY_ID)
+    {
+        mEntityRecords[GetEntityIndex(relocatedEntityId)].mRow = sourceRow;
+    }
+    
+    entityRecord.mArchetype = &targetArchetype;
+    entityRecord.mRow = targetRow;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void World::OnEntityChanged(const EntityId entityId, const ComponentMask& newComponentMask)
+ComponentMask& World::GetObservedComponentMask(const ObserverEventType eventType)
 {
-    for (auto& system: mSystems)
+    switch (eventType)
     {
-        auto& systemRef = *system;
-        auto& systemEntityVec = mEntitiesToUpdatePerSystem[typeid(systemRef)];
+        case ObserverEventType::ADD: return mObservedAddComponentMask;
+        case ObserverEventType::REMOVE: return mObservedRemoveComponentMask;
+        case ObserverEventType::CHANGE: return mObservedChangeComponentMask;
+    }
+    
+    assert(false && "Unknown observer event type");
+    return mObservedAddComponentMask;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::InvokeObservers(const ObserverEventType eventType, const ComponentTypeId componentTypeId, const EntityId entityId, const void* component)
+{
+    ++mObserverDispatchDepth;
+    
+    // Indexed iteration, since observers registered by observers are appended during the loop
+    for (auto observerIndex = 0U; observerIndex < mObservers.size(); ++observerIndex)
+    {
+        const auto& observer = *mObservers[observerIndex];
+        if (observer.mId != NULL_OBSERVER_ID && observer.mEventType == eventType && observer.mComponentTypeId == componentTypeId)
+        {
+            observer.mFunction(entityId, component);
+        }
+    }
+    
+    --mObserverDispatchDepth;
+    CompactObservers();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::DispatchPendingObserverEvents()
+{
+    // Observers can make further structural changes, which are queued and dispatched in the next round
+    std::vector<ObserverEvent> observerEvents;
+    while (mPendingObserverEvents.empty() == false)
+    {
+        observerEvents.swap(mPendingObserverEvents);
+        
+        for (const auto& observerEvent: observerEvents)
+        {
+            if (observerEvent.mEventType == ObserverEventType::REMOVE)
+            {
+                InvokeObservers(observerEvent.mEventType, observerEvent.mComponentTypeId, observerEvent.mEntityId, nullptr);
+                continue;
+            }
+            
+            // Additions of components that have been removed again before the flush are skipped
+            if (HasEntity(observerEvent.mEntityId) == false)
+            {
+                continue;
+            }
+            
+            const auto& entityRecord = mEntityRecords[GetEntityIndex(observerEvent.mEntityId)];
+            if (entityRecord.mArchetype->GetComponentMask()[observerEvent.mComponentTypeId])
+            {
+                InvokeObservers(observerEvent.mEventType, observerEvent.mComponentTypeId, observerEvent.mEntityId, entityRecord.mArchetype->GetComponentAddress(observerEvent.mComponentTypeId, entityRecord.mRow));
+            }
+        }
+        
+        observerEvents.clear();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::DispatchChangeObserverEvents()
+{
+    if (mObservedChangeComponentMask == ComponentMask())
+    {
+        return;
+    }
+    
+    const auto sinceTick = mLastObservedChangeTick;
+    
+    // Components accessed from here on (including by the observers) get a newer tick, and are observed on the next dispatch
+    mLastObservedChangeTick = mChangeTick++;
+    
+    // Changed entities are gathered up front, since observers may restructure the archetypes
+    std::vector<ObserverEvent> observerEvents;
+    for (const auto& archetype: mArchetypes)
+    {
+        const auto observedComponentMask = archetype->GetComponentMask() & mObservedChangeComponentMask;
+        if (observedComponentMask == ComponentMask())
+        {
+            continue;
+        }
         
-        if
-        (
-            system->ShouldProcessComponentMask(newComponentMask) &&
-            std::find(systemEntityVec.cbegin(), systemEntityVec.cend(), entityId) == systemEntityVec.cend()
-        )
+        const auto& entities = archetype->GetEntities();
+        for (ComponentTypeId componentTypeId = 0; componentTypeId < MAX_COMPONENTS; ++componentTypeId)
         {
-            systemEntityVec.push_back(entityId);
+            if (observedComponentMask[componentTypeId] == false)
+            {
+                continue;
+            }
+            
+            for (auto row = 0U; row < entities.size(); ++row)
+            {
+                if (IsChangeTickNewer(*archetype->GetChangeTickAddress(componentTypeId, row), sinceTick))
+                {
+                    observerEvents.push_back(ObserverEvent{ ObserverEventType::CHANGE, componentTypeId, entities[row] });
+                }
+            }
         }
-        else if
-        (
-            system->ShouldProcessComponentMask(newComponentMask) == false &&
-            std::find(systemEntityVec.cbegin(), systemEntityVec.cend(), entityId) != systemEntityVec.cend()
-        )
+    }
+    
+    for (const auto& observerEvent: observerEvents)
+    {
+        if (HasEntity(observerEvent.mEntityId) == false)
+        {
+            continue;
+        }
+        
+        const auto& entityRecord = mEntityRecords[GetEntityIndex(observerEvent.mEntityId)];
+        if (entityRecord.mArchetype->GetComponentMask()[observerEvent.mComponentTypeId])
         {
-            systemEntityVec.erase(std::remove(systemEntityVec.begin(), systemEntityVec.end(), entityId), systemEntityVec.end());
+            InvokeObservers(observerEvent.mEventType, observerEvent.mComponentTypeId, observerEvent.mEntityId, entityRecord.mArchetype->GetComponentAddress(observerEvent.mComponentTypeId, entityRecord.mRow));
         }
     }
 }
 
 ///------------------------------------------------------------------------------------------------
 
+void World::CompactObservers()
+{
+    if (mObserverDispatchDepth > 0U || mHasRemovedObservers == false)
+    {
+        return;
+    }
+    
+    mObservers.erase(std::remove_if(mObservers.begin(), mObservers.end(), [](const std::unique_ptr<Observer>& observer)
+    {
+        return observer->mId == NULL_OBSERVER_ID;
+    }), mObservers.end());
+    
+    mHasRemovedObservers = false;
+}
+
+///------------------------------------------------------------------------------------------------
+
 World::World()
 {
-    mEntityComponentStore.reserve(ANTICIPATED_ENTITY_COUNT);
+    mEntityRecords.reserve(ANTICIPATED_ENTITY_COUNT);
+    mEmptyArchetype = &GetOrCreateArchetype(ComponentMask());
+    
+    AddComponentIndex<NameComponent, StringId, StringIdHasher>([](const NameComponent& nameComponent)
+    {
+        return nameComponent.mName;
+    });
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -14,16 +14,24 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include "common/utils/LinearArena.h"
 #include "common/utils/StringUtils.h"
 #include "common/utils/TypeTraits.h"
+#include "jobs/JobSystem.h"
 
 #include <algorithm>
 #include <array>
-#include <bitset>        
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <tsl/robin_map.h>
+#include <type_traits>
 #include <vector>        
 
 ///------------------------------------------------------------------------------------------------
@@ -34,83 +42,1028 @@ namespace genesis
 namespace ecs
 {
 
-/// Max component type count allowed
-static constexpr int MAX_COMPONENTS = 32;
+/// Max component type count allowed (entity and singleton component types combined).
+/// Can be overridden at build time, and needs to be a multiple of 64
+#ifndef GENESIS_MAX_COMPONENTS
+#define GENESIS_MAX_COMPONENTS 64
+#endif
+static constexpr int MAX_COMPONENTS = GENESIS_MAX_COMPONENTS;
+static_assert(MAX_COMPONENTS > 0 && MAX_COMPONENTS % 64 == 0, "MAX_COMPONENTS needs to be a positive multiple of 64");
 
 /// Initial guess for the average entities handled
 /// so that multiple resizes won't be needed
 static constexpr int ANTICIPATED_ENTITY_COUNT = 1000;
 
+/// Number of entity rows held by each storage chunk
+/// of an archetype's component columns
+static constexpr std::size_t ARCHETYPE_CHUNK_CAPACITY = 256U;
+
+/// Size in bytes of each memory block of a command buffer's
+/// arena for the components pending addition
+static constexpr std::size_t COMMAND_BUFFER_ARENA_BLOCK_SIZE = 16U * 1024U;
+
+/// Max number of components of destroyed entities that are destroyed
+/// per world update, so that large despawns are spread over several frames
+static constexpr std::size_t MAX_DEFERRED_COMPONENT_DESTRUCTIONS_PER_UPDATE = 4096U;
+
+/// Size in bytes of each memory block holding the components
+/// of destroyed entities until their deferred destruction
+static constexpr std::size_t DEFERRED_DESTRUCTION_ARENA_BLOCK_SIZE = 64U * 1024U;
+
 /// Null entity ID
 static constexpr long long NULL_ENTITY_ID = 0LL;
 
-///------------------------------------------------------------------------------------------------
+///------------------------------------------------------------------------------------------------
+
+class Archetype;
+class EntityCommandBuffer;
+class World;
+class ISystem;
+class IComponent;
+
+using ComponentTypeId = int;
+using SystemTypeId    = int;
+using EntityId        = long long;
+
+///------------------------------------------------------------------------------------------------
+/// Entity ids are generational handles. The low 32 bits hold the index of the entity's slot in the
+/// world's dense entity storage, while the high 32 bits hold the generation of that slot, which is
+/// bumped whenever the slot is recycled so that stale ids can be detected. Generations start at 1
+/// and stay below 2^31, so that valid entity ids are always positive (negative ids are reserved
+/// for entities pending creation in command buffers).
+using EntityIndex      = std::uint32_t;
+using EntityGeneration = std::uint32_t;
+
+/// Generation of the first entity created in each entity slot
+static constexpr EntityGeneration INITIAL_ENTITY_GENERATION = 1U;
+
+/// Generation after which an entity slot's generation wraps around to INITIAL_ENTITY_GENERATION
+static constexpr EntityGeneration MAX_ENTITY_GENERATION = 0x7FFFFFFFU;
+
+/// Gets the storage slot index of the given entity id.
+/// @param[in] entityId the entity id to get the index of.
+/// @returns the index part of the entity id.
+inline EntityIndex GetEntityIndex(const EntityId entityId)
+{
+    return static_cast<EntityIndex>(static_cast<std::uint64_t>(entityId) & 0xFFFFFFFFULL);
+}
+
+/// Gets the generation of the given entity id.
+/// @param[in] entityId the entity id to get the generation of.
+/// @returns the generation part of the entity id.
+inline EntityGeneration GetEntityGeneration(const EntityId entityId)
+{
+    return static_cast<EntityGeneration>(static_cast<std::uint64_t>(entityId) >> 32);
+}
+
+/// Composes an entity id from the given index and generation.
+/// @param[in] entityIndex the storage slot index of the entity.
+/// @param[in] entityGeneration the generation of the entity's slot.
+/// @returns the composed entity id.
+inline EntityId MakeEntityId(const EntityIndex entityIndex, const EntityGeneration entityGeneration)
+{
+    return static_cast<EntityId>((static_cast<std::uint64_t>(entityGeneration) << 32) | entityIndex);
+}
+
+///------------------------------------------------------------------------------------------------
+/// Change ticks stamp the components of every entity with the world tick at which they were last
+/// added or mutably accessed. The world tick advances between system update stages, and systems
+/// remember the tick of their last update, so that they can only process components changed since then.
+using ChangeTick = std::uint32_t;
+
+/// Checks whether a change tick is more recent than another one, allowing for tick wrap-around.
+/// @param[in] changeTick the change tick to check.
+/// @param[in] sinceTick the change tick to compare against.
+/// @returns whether changeTick is more recent than sinceTick.
+inline bool IsChangeTickNewer(const ChangeTick changeTick, const ChangeTick sinceTick)
+{
+    return static_cast<std::int32_t>(changeTick - sinceTick) > 0;
+}
+
+///------------------------------------------------------------------------------------------------
+/// Observers are callbacks notified of component additions, removals and changes. They are not invoked
+/// in the middle of structural changes, but in batches at the world's flush points (i.e. after each
+/// command buffer playback), always on the main thread. @see World::OnAdd()
+using ObserverId = std::uint32_t;
+
+/// Id never handed out to observers
+static constexpr ObserverId NULL_OBSERVER_ID = 0U;
+
+///------------------------------------------------------------------------------------------------
+/// The phases of a frame that systems can be updated in. @see World::Update()
+enum class SystemUpdatePhase
+{
+    /// Updated at a fixed rate, i.e. zero or more times per frame (the default)
+    SIMULATION,
+
+    /// Updated once per rendered frame, after the frame's simulation ticks
+    PRESENTATION,
+
+    COUNT
+};
+
+///------------------------------------------------------------------------------------------------
+
+struct ComponentTypeIdHasher
+{
+    std::size_t operator()(const ComponentTypeId& key) const
+    {
+        return static_cast<std::size_t>(key);
+    }
+};
+
+struct EntityIdHasher
+{
+    std::size_t operator()(const EntityId& key) const
+    {
+        return static_cast<std::size_t>(key);
+    }
+};
+
+///------------------------------------------------------------------------------------------------
+/// Fixed-size bit mask with one bit per component type id.
+///
+/// The bits are packed in an aligned array of 64-bit words, and all mask operations are branchless
+/// loops over the words, so that for the usual limits (64 to 256 component types) they compile down
+/// to a handful of (vector) instructions.
+class ComponentMask final
+{
+public:
+    static constexpr std::size_t WORD_BIT_COUNT = 64U;
+    static constexpr std::size_t WORD_COUNT     = MAX_COMPONENTS / WORD_BIT_COUNT;
+
+    /// @param[in] componentTypeId the component type id whose bit to set.
+    inline void Set(const ComponentTypeId componentTypeId)
+    {
+        assert(componentTypeId >= 0 && componentTypeId < MAX_COMPONENTS &&
+            "Component type id out of the mask's range");
+
+        mWords[componentTypeId / WORD_BIT_COUNT] |= GetWordBit(componentTypeId);
+    }
+
+    /// @param[in] componentTypeId the component type id whose bit to clear.
+    inline void Reset(const ComponentTypeId componentTypeId)
+    {
+        assert(componentTypeId >= 0 && componentTypeId < MAX_COMPONENTS &&
+            "Component type id out of the mask's range");
+
+        mWords[componentTypeId / WORD_BIT_COUNT] &= ~GetWordBit(componentTypeId);
+    }
+
+    /// @param[in] componentTypeId the component type id whose bit to check.
+    /// @returns whether the bit of the given component type id is set.
+    inline bool operator [] (const ComponentTypeId componentTypeId) const
+    {
+        assert(componentTypeId >= 0 && componentTypeId < MAX_COMPONENTS &&
+            "Component type id out of the mask's range");
+
+        return (mWords[componentTypeId / WORD_BIT_COUNT] & GetWordBit(componentTypeId)) != 0U;
+    }
+
+    /// @param[in] other the mask to check against.
+    /// @returns whether all bits set in the given mask are also set in this one.
+    inline bool Contains(const ComponentMask& other) const
+    {
+        std::uint64_t missingBits = 0U;
+        for (auto i = 0U; i < WORD_COUNT; ++i)
+        {
+            missingBits |= other.mWords[i] & ~mWords[i];
+        }
+        
+        return missingBits == 0U;
+    }
+
+    /// @param[in] other the mask to check against.
+    /// @returns whether this mask and the given one have any bits set in common.
+    inline bool Intersects(const ComponentMask& other) const
+    {
+        std::uint64_t commonBits = 0U;
+        for (auto i = 0U; i < WORD_COUNT; ++i)
+        {
+            commonBits |= other.mWords[i] & mWords[i];
+        }
+        
+        return commonBits != 0U;
+    }
+
+    /// @returns a hash of the mask's bits.
+    inline std::size_t GetHash() const
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (auto i = 0U; i < WORD_COUNT; ++i)
+        {
+            hash = (hash ^ mWords[i]) * 1099511628211ULL;
+        }
+        
+        return static_cast<std::size_t>(hash ^ (hash >> 32));
+    }
+
+    inline ComponentMask operator & (const ComponentMask& other) const
+    {
+        ComponentMask result;
+        for (auto i = 0U; i < WORD_COUNT; ++i)
+        {
+            result.mWords[i] = mWords[i] & other.mWords[i];
+        }
+        
+        return result;
+    }
+
+    inline ComponentMask operator | (const ComponentMask& other) const
+    {
+        ComponentMask result;
+        for (auto i = 0U; i < WORD_COUNT; ++i)
+        {
+            result.mWords[i] = mWords[i] | other.mWords[i];
+        }
+        
+        return result;
+    }
+
+    inline ComponentMask operator ~ () const
+    {
+        ComponentMask result;
+        for (auto i = 0U; i < WORD_COUNT; ++i)
+        {
+            result.mWords[i] = ~mWords[i];
+        }
+        
+        return result;
+    }
+
+    inline bool operator == (const ComponentMask& other) const
+    {
+        std::uint64_t differentBits = 0U;
+        for (auto i = 0U; i < WORD_COUNT; ++i)
+        {
+            differentBits |= mWords[i] ^ other.mWords[i];
+        }
+        
+        return differentBits == 0U;
+    }
+
+    inline bool operator != (const ComponentMask& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    static inline std::uint64_t GetWordBit(const ComponentTypeId componentTypeId)
+    {
+        return std::uint64_t(1) << (componentTypeId % WORD_BIT_COUNT);
+    }
+
+private:
+    alignas(WORD_COUNT >= 4 ? 32 : 16) std::array<std::uint64_t, WORD_COUNT> mWords = {};
+};
+
+struct ComponentMaskHasher
+{
+    std::size_t operator()(const ComponentMask& key) const
+    {
+        return key.GetHash();
+    }
+};
+
+///------------------------------------------------------------------------------------------------
+/// Hands out sequential ids to component classes (both entity and singleton ones). Kept separate
+/// from the engine-wide TypeID counter, so that only component classes use up component mask bits.
+class ComponentTypeIdRegistry final
+{
+public:
+    /// @tparam ComponentType the component type class to get the id of.
+    /// @returns the id of the given component class, assigned on first use.
+    template<class ComponentType>
+    static inline ComponentTypeId GetId()
+    {
+        static const ComponentTypeId componentTypeId = sNextComponentTypeId++;
+        assert(componentTypeId < MAX_COMPONENTS &&
+            "Component type count exceeds MAX_COMPONENTS");
+        
+        return componentTypeId;
+    }
+
+private:
+    static std::atomic<ComponentTypeId> sNextComponentTypeId;
+};
+
+/// Gets the component type id of the given component class.
+/// @tparam ComponentType the component type class (const qualifiers are ignored).
+/// @returns the component type id of the given component class.
+template<class ComponentType>
+inline ComponentTypeId GetComponentTypeId()
+{
+    return ComponentTypeIdRegistry::GetId<std::remove_const_t<ComponentType>>();
+}
+
+///------------------------------------------------------------------------------------------------
+/// Base class of all components in the engine. All custom components needs to inherit from
+/// this class.
+///
+/// The base is an empty, non-virtual tag, so components holding plain data stay trivially copyable.
+/// Such components are relocated with a plain memcpy, and their packed columns can be snapshotted or
+/// processed in bulk. Components are never destroyed through an IComponent pointer; the world always
+/// destroys them through their concrete type.
+class IComponent
+{
+};
+
+///------------------------------------------------------------------------------------------------
+/// To be used when a system doesn't care about any component types in its update
+class NullComponent final: public IComponent
+{
+};
+
+///------------------------------------------------------------------------------------------------
+/// Type-erased description of a component class. Used by the archetype tables to relocate and
+/// destroy components without any knowledge of their concrete types.
+struct ComponentTypeInfo
+{
+    using MoveConstructFunction = void(*)(void* destination, void* source);
+    using DestroyFunction       = void(*)(void* component);
+
+    std::size_t mSize                    = 0U;
+    std::size_t mAlignment               = 0U;
+    bool mIsTriviallyCopyable            = false;
+    MoveConstructFunction mMoveConstruct = nullptr;
+    DestroyFunction mDestroy             = nullptr;
+
+    /// Moves the component at the given source address to the (unconstructed) destination address,
+    /// and destroys the source component.
+    /// @param[in] destination the address to relocate the component to.
+    /// @param[in] source the address of the component to relocate.
+    inline void Relocate(void* destination, void* source) const
+    {
+        if (mIsTriviallyCopyable)
+        {
+            std::memcpy(destination, source, mSize);
+        }
+        else
+        {
+            mMoveConstruct(destination, source);
+            mDestroy(source);
+        }
+    }
+
+    /// Destroys the component at the given address.
+    /// @param[in] component the address of the component to destroy.
+    inline void Destroy(void* component) const
+    {
+        // Trivially copyable types are also trivially destructible
+        if (!mIsTriviallyCopyable)
+        {
+            mDestroy(component);
+        }
+    }
+};
+
+///------------------------------------------------------------------------------------------------
+/// Gets the type-erased description of the given component class.
+/// @tparam ComponentType the derived component type class to describe.
+/// @returns the (statically allocated) type info of the given component class.
+template<class ComponentType>
+inline const ComponentTypeInfo& GetComponentTypeInfo()
+{
+    static const ComponentTypeInfo typeInfo =
+    {
+        sizeof(ComponentType),
+        alignof(ComponentType),
+        std::is_trivially_copyable<ComponentType>::value,
+        [](void* destination, void* source)
+        {
+            new (destination) ComponentType(std::move(*static_cast<ComponentType*>(source)));
+        },
+        [](void* component)
+        {
+            static_cast<ComponentType*>(component)->~ComponentType();
+        }
+    };
+
+    return typeInfo;
+}
+
+///------------------------------------------------------------------------------------------------
+/// Used to tell the in-place component construction overloads apart from the ones taking
+/// ownership of an already heap allocated component.
+template<class Type>
+struct IsUniquePtr: std::false_type {};
+
+template<class PointeeType, class DeleterType>
+struct IsUniquePtr<std::unique_ptr<PointeeType, DeleterType>>: std::true_type {};
+
+template<class... ArgTypes>
+struct IsSingleUniquePtrArgument: std::false_type {};
+
+template<class ArgType>
+struct IsSingleUniquePtrArgument<ArgType>: IsUniquePtr<std::decay_t<ArgType>> {};
+
+///------------------------------------------------------------------------------------------------
+/// Holds the components of destroyed entities until they are destroyed in bounded batches.
+///
+/// Components are relocated into one of two linear arenas: the filling one receives the components
+/// of entities destroyed since the last batch switch, while the draining one is destroyed in order.
+/// Once the draining arena has been fully destroyed it is reset and the two swap roles, so steady
+/// despawning keeps reusing the same memory. Components still queued on destruction of the queue
+/// are destroyed right away.
+class DeferredComponentDestructionQueue final
+{
+public:
+    DeferredComponentDestructionQueue();
+    ~DeferredComponentDestructionQueue();
+
+    DeferredComponentDestructionQueue(const DeferredComponentDestructionQueue&) = delete;
+    const DeferredComponentDestructionQueue& operator = (const DeferredComponentDestructionQueue&) = delete;
+
+    /// Relocates the given component into the queue, leaving its original storage unoccupied.
+    /// @param[in] typeInfo the type info of the component. Needs to outlive the queued component.
+    /// @param[in] component the address of the component to queue for destruction.
+    void Enqueue(const ComponentTypeInfo& typeInfo, void* component);
+
+    /// Destroys queued components, oldest first.
+    /// @param[in] maxComponentCount the max number of components to destroy.
+    void DestroyQueuedComponents(const std::size_t maxComponentCount);
+
+private:
+    struct Batch
+    {
+        Batch();
+
+        LinearArena mArena;
+        std::vector<std::pair<const ComponentTypeInfo*, void*>> mComponents;
+        std::size_t mDestroyedComponentCount;
+    };
+
+    std::array<Batch, 2> mBatches;
+    std::size_t mFillingBatchIndex;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Slab allocator recycling the storage chunks of all archetype columns of a single component type.
+///
+/// Chunks released by shrinking (or destroyed) columns are kept around and handed out again to
+/// the next column of the same type that needs to grow, so that entities moving between archetypes
+/// do not keep hitting the general purpose heap.
+class ComponentChunkPool final
+{
+public:
+    /// @param[in] typeInfo the type info of the component type whose chunks are pooled.
+    explicit ComponentChunkPool(const ComponentTypeInfo& typeInfo);
+    ~ComponentChunkPool();
+
+    ComponentChunkPool(const ComponentChunkPool&) = delete;
+    const ComponentChunkPool& operator = (const ComponentChunkPool&) = delete;
+
+    /// @returns the type info of the component type whose chunks are pooled.
+    inline const ComponentTypeInfo& GetTypeInfo() const
+    {
+        return *mTypeInfo;
+    }
+
+    /// Hands out storage for ARCHETYPE_CHUNK_CAPACITY components, reusing a released chunk if available.
+    /// @returns the (uninitialized) chunk storage.
+    unsigned char* AllocateChunk();
+
+    /// Returns the given chunk to the pool. Any components in it need to have already been destroyed.
+    /// @param[in] chunk the chunk to release, previously allocated from this pool.
+    void ReleaseChunk(unsigned char* chunk);
+
+private:
+    const ComponentTypeInfo* mTypeInfo;
+    std::vector<unsigned char*> mFreeChunks;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Packed storage of all components of a single type, belonging to the entities of an archetype.
+///
+/// Components are stored by value in fixed-size chunks of ARCHETYPE_CHUNK_CAPACITY rows each,
+/// so that growing a column never relocates the components already stored in it. Chunks are
+/// allocated from (and released back to) the component type's ComponentChunkPool.
+class ComponentColumn final
+{
+public:
+    explicit ComponentColumn(ComponentChunkPool& chunkPool);
+    ~ComponentColumn();
+
+    ComponentColumn(ComponentColumn&&) = default;
+    ComponentColumn(const ComponentColumn&) = delete;
+    ComponentColumn& operator = (const ComponentColumn&) = delete;
+
+    /// @returns the type info of the components stored in this column.
+    inline const ComponentTypeInfo& GetTypeInfo() const
+    {
+        return *mTypeInfo;
+    }
+
+    /// @param[in] row the row to get the component address of.
+    /// @returns the address of the component stored at the given row.
+    inline void* GetComponentAddress(const std::size_t row) const
+    {
+        return mChunks[row / ARCHETYPE_CHUNK_CAPACITY] + (row % ARCHETYPE_CHUNK_CAPACITY) * mTypeInfo->mSize;
+    }
+
+    /// @param[in] row the row to get the change tick of.
+    /// @returns the address of the change tick of the component stored at the given row. The change ticks of
+    /// consecutive rows are stored contiguously.
+    inline ChangeTick* GetChangeTickAddress(const std::size_t row)
+    {
+        return &mChangeTicks[row];
+    }
+
+    /// Allocates storage for another ARCHETYPE_CHUNK_CAPACITY rows.
+    void AddChunk();
+
+    /// Releases the storage of the last ARCHETYPE_CHUNK_CAPACITY rows, which need to be unoccupied.
+    void RemoveChunk();
+
+private:
+    ComponentChunkPool* mChunkPool;
+    const ComponentTypeInfo* mTypeInfo;
+    std::vector<unsigned char*> mChunks;
+    std::vector<ChangeTick> mChangeTicks;
+};
+
+///------------------------------------------------------------------------------------------------
+/// A table holding all entities that share the exact same component mask.
+///
+/// Each component type in the mask is stored in its own packed column, and every entity
+/// of the archetype occupies the same row in all of its columns.
+class Archetype final
+{
+    friend class World;
+
+public:
+    /// @param[in] componentMask the component mask shared by all entities of this archetype.
+    /// @param[in] componentChunkPools the chunk pools of all registered component types, indexed by component type id.
+    Archetype(const ComponentMask& componentMask, const std::vector<std::unique_ptr<ComponentChunkPool>>& componentChunkPools);
+    ~Archetype();
+
+    Archetype(const Archetype&) = delete;
+    const Archetype& operator = (const Archetype&) = delete;
+
+    /// @returns the component mask shared by all entities of this archetype.
+    inline const ComponentMask& GetComponentMask() const
+    {
+        return mComponentMask;
+    }
+
+    /// @returns the entities of this archetype, indexed by their row.
+    inline const std::vector<EntityId>& GetEntities() const
+    {
+        return mEntities;
+    }
+
+    /// @returns the number of entities currently stored in this archetype.
+    inline std::size_t GetEntityCount() const
+    {
+        return mEntities.size();
+    }
+
+    /// Gets the address of the component of the given type at the given row.
+    /// @param[in] componentTypeId the type id of the component to get. Needs to be present in the archetype's mask.
+    /// @param[in] row the row of the entity to get the component of.
+    /// @returns the address of the component.
+    inline void* GetComponentAddress(const ComponentTypeId componentTypeId, const std::size_t row) const
+    {
+        assert(mComponentMask[componentTypeId] &&
+            "Component type is not stored in this archetype");
+
+        return mColumns[mColumnIndices[componentTypeId]].GetComponentAddress(row);
+    }
+
+    /// Gets the change tick of the component of the given type at the given row.
+    /// @param[in] componentTypeId the type id of the component. Needs to be present in the archetype's mask.
+    /// @param[in] row the row of the entity to get the component change tick of.
+    /// @returns the address of the change tick. The change ticks of consecutive rows are stored contiguously.
+    inline ChangeTick* GetChangeTickAddress(const ComponentTypeId componentTypeId, const std::size_t row)
+    {
+        assert(mComponentMask[componentTypeId] &&
+            "Component type is not stored in this archetype");
+
+        return mColumns[mColumnIndices[componentTypeId]].GetChangeTickAddress(row);
+    }
+
+    /// Gets the component of the given type at the given row.
+    /// @tparam ComponentType the derived component type class to get.
+    /// @param[in] componentTypeId the type id of the component to get. Needs to be present in the archetype's mask.
+    /// @param[in] row the row of the entity to get the component of.
+    /// @returns the component of the entity at the given row.
+    template<class ComponentType>
+    [[nodiscard]] inline ComponentType& GetComponent(const ComponentTypeId componentTypeId, const std::size_t row) const
+    {
+        return *static_cast<ComponentType*>(GetComponentAddress(componentTypeId, row));
+    }
+
+private:
+    /// Appends a row for the given entity. The components of the new row are left unconstructed.
+    /// @param[in] entityId the entity to allocate the row for.
+    /// @returns the newly allocated row.
+    std::size_t AllocateRow(const EntityId entityId);
+
+    /// Frees the given row, whose components must have already been destroyed or moved out.
+    ///
+    /// The last row of the archetype is relocated to the freed row to keep the columns packed, and
+    /// column chunks that are no longer needed are released back to their chunk pools.
+    /// @param[in] row the row to free.
+    /// @returns the id of the entity that was relocated to the freed row, or NULL_ENTITY_ID if none was.
+    EntityId FreeRow(const std::size_t row);
+
+    /// Destroys all components and frees all rows of this archetype.
+    void Clear();
+
+private:
+    using ArchetypeTransitionMap = tsl::robin_map<ComponentTypeId, Archetype*, ComponentTypeIdHasher>;
+
+    const ComponentMask mComponentMask;
+    std::vector<EntityId> mEntities;
+    std::vector<ComponentColumn> mColumns;
+    std::vector<ComponentTypeId> mColumnComponentTypeIds;
+    std::vector<int> mColumnIndices;
+    std::size_t mRowCapacity;
+
+    // Cached neighbouring archetypes reached by adding or removing a single component type
+    ArchetypeTransitionMap mAddComponentTransitions;
+    ArchetypeTransitionMap mRemoveComponentTransitions;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Sparse set of entity ids. Supports O(1) insertion, removal and membership queries,
+/// while keeping all entities packed in a vector for iteration. The sparse part is indexed
+/// directly by the entities' storage slot indices.
+class EntitySparseSet final
+{
+public:
+    /// @returns the packed entities of the set. Their order changes on removals.
+    inline const std::vector<EntityId>& GetEntities() const
+    {
+        return mDenseEntities;
+    }
+
+    /// @param[in] entityId the entity to check for.
+    /// @returns whether the given entity is part of the set.
+    inline bool Contains(const EntityId entityId) const
+    {
+        const auto entityIndex = GetEntityIndex(entityId);
+        return entityIndex < mSparseIndices.size() &&
+            mSparseIndices[entityIndex] != INVALID_DENSE_INDEX &&
+            mDenseEntities[mSparseIndices[entityIndex]] == entityId;
+    }
+
+    /// Adds the given entity to the set, if not already part of it.
+    /// @param[in] entityId the entity to add.
+    inline void Insert(const EntityId entityId)
+    {
+        if (Contains(entityId))
+        {
+            return;
+        }
+
+        const auto entityIndex = GetEntityIndex(entityId);
+        if (entityIndex >= mSparseIndices.size())
+        {
+            mSparseIndices.resize(entityIndex + 1, INVALID_DENSE_INDEX);
+        }
+
+        mSparseIndices[entityIndex] = mDenseEntities.size();
+        mDenseEntities.push_back(entityId);
+    }
+
+    /// Removes the given entity from the set, if part of it. The last entity of the set takes its place.
+    /// @param[in] entityId the entity to remove.
+    inline void Erase(const EntityId entityId)
+    {
+        if (!Contains(entityId))
+        {
+            return;
+        }
+
+        const auto entityIndex = GetEntityIndex(entityId);
+        const auto denseIndex  = mSparseIndices[entityIndex];
+        
+        mDenseEntities[denseIndex] = mDenseEntities.back();
+        mSparseIndices[GetEntityIndex(mDenseEntities[denseIndex])] = denseIndex;
+        mSparseIndices[entityIndex] = INVALID_DENSE_INDEX;
+
+        mDenseEntities.pop_back();
+    }
+
+private:
+    static constexpr std::size_t INVALID_DENSE_INDEX = static_cast<std::size_t>(-1);
+
+    std::vector<EntityId> mDenseEntities;
+    std::vector<std::size_t> mSparseIndices;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Base class of all component indices. The world notifies the index registered for a component
+/// type whenever a component of that type is added to or removed from an entity.
+class IComponentIndex
+{
+public:
+    IComponentIndex() = default;
+    virtual ~IComponentIndex() = default;
+    IComponentIndex(const IComponentIndex&) = delete;
+    const IComponentIndex& operator = (const IComponentIndex&) = delete;
+
+    /// Called right after a component of the indexed type has been added to an entity.
+    /// @param[in] entityId the entity the component was added to.
+    /// @param[in] component the address of the added component.
+    virtual void VOnComponentAdded(const EntityId entityId, const void* component) = 0;
+
+    /// Called right before a component of the indexed type is removed from an entity (or the entity is destroyed).
+    /// @param[in] entityId the entity the component is removed from.
+    /// @param[in] component the address of the component being removed.
+    virtual void VOnComponentRemoved(const EntityId entityId, const void* component) = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Secondary index mapping keys extracted from components of a given type, to all entities owning
+/// such a component, so that entities can be looked up by key without scanning the world.
+///
+/// Keys are extracted once, when the component is added. Components should therefore not have their
+/// key changed in place; the component needs to be removed and re-added instead.
+/// @tparam ComponentType the derived component type class to index.
+/// @tparam KeyType the type of the keys extracted from the components.
+/// @tparam KeyHasher the hasher of the keys.
+template<class ComponentType, class KeyType, class KeyHasher = std::hash<KeyType>>
+class ComponentIndex final: public IComponentIndex
+{
+public:
+    using KeyExtractor = KeyType(*)(const ComponentType&);
+
+    /// @param[in] keyExtractor the function extracting the key of each indexed component.
+    explicit ComponentIndex(KeyExtractor keyExtractor)
+        : mKeyExtractor(keyExtractor)
+    {
+    }
+
+    /// Finds all entities owning a component with the given key.
+    /// @param[in] key the key to look up.
+    /// @returns the entities found, in no particular order. Invalidated by the next structural change.
+    inline const std::vector<EntityId>& Find(const KeyType& key) const
+    {
+        static const std::vector<EntityId> NO_ENTITIES;
+
+        const auto entitiesIter = mEntitiesByKey.find(key);
+        return entitiesIter == mEntitiesByKey.cend() ? NO_ENTITIES : entitiesIter->second;
+    }
+
+    inline void VOnComponentAdded(const EntityId entityId, const void* component) override
+    {
+        mEntitiesByKey[mKeyExtractor(*static_cast<const ComponentType*>(component))].push_back(entityId);
+    }
+
+    inline void VOnComponentRemoved(const EntityId entityId, const void* component) override
+    {
+        auto entitiesIter = mEntitiesByKey.find(mKeyExtractor(*static_cast<const ComponentType*>(component)));
+        assert(entitiesIter != mEntitiesByKey.end() &&
+            "Removed component was never indexed");
+
+        auto& entities = entitiesIter.value();
+        auto entityIter = std::find(entities.begin(), entities.end(), entityId);
+        assert(entityIter != entities.end() &&
+            "Removed component's entity was never indexed");
+
+        *entityIter = entities.back();
+        entities.pop_back();
+
+        if (entities.empty())
+        {
+            mEntitiesByKey.erase(entitiesIter);
+        }
+    }
+
+private:
+    const KeyExtractor mKeyExtractor;
+    tsl::robin_map<KeyType, std::vector<EntityId>, KeyHasher> mEntitiesByKey;
+};
+
+///------------------------------------------------------------------------------------------------
+/// View filter restricting a view to entities whose component of the given type has been added or
+/// mutably accessed after the given tick. @see World::View()
+/// @tparam ComponentType the component type class to check for changes.
+template<class ComponentType>
+struct Changed final
+{
+    ChangeTick mSinceTick = 0U;
+};
+
+///------------------------------------------------------------------------------------------------
+/// A typed view over all entities that own (at least) the given component types.
+///
+/// Iteration walks the matching archetypes' columns directly, yielding component references
+/// without any per-entity lookups. Component types can be const-qualified to denote read-only access.
+/// The view is a snapshot of the matching archetypes, so entities must not be added to or removed from
+/// them while iterating (i.e. no structural changes on the iterated entities inside the callbacks).
+///
+/// Iterating a view stamps the non-const component types of all yielded entities as changed.
+/// Views can optionally be restricted to entities whose components have changed. @see Changed
+/// @tparam ComponentTypes the component type classes that the viewed entities need to own.
+template<class... ComponentTypes>
+class ComponentView final
+{
+public:
+    /// A requirement for a component type to have changed after a given tick.
+    struct ChangeFilter
+    {
+        ComponentTypeId mComponentTypeId;
+        ChangeTick mSinceTick;
+    };
+
+    /// @param[in] archetypes the archetypes whose entities match this view's component mask.
+    /// @param[in] changeTick the world tick to stamp mutably accessed components with.
+    /// @param[in] changeFilters the change requirements that yielded entities need to meet (all of them).
+    ComponentView(std::vector<Archetype*> archetypes, const ChangeTick changeTick, std::vector<ChangeFilter> changeFilters)
+        : mArchetypes(std::move(archetypes))
+        , mChangeFilters(std::move(changeFilters))
+        , mChangeTick(changeTick)
+    {
+    }
+
+    /// Calculates the component mask that entities need to match to be part of this view.
+    /// @returns the component mask of this view.
+    [[nodiscard]] static inline ComponentMask GetComponentMask()
+    {
+        ComponentMask componentMask;
+        (componentMask.Set(GetComponentTypeId<ComponentTypes>()), ...);
+        return componentMask;
+    }
+
+    /// @returns the number of entities in this view. For filtered views, the number of entities before filtering.
+    [[nodiscard]] inline std::size_t GetEntityCount() const
+    {
+        std::size_t entityCount = 0U;
+        for (const auto* archetype: mArchetypes)
+        {
+            entityCount += archetype->GetEntityCount();
+        }
+
+        return entityCount;
+    }
 
-class World;
-class ISystem;
-class IComponent;
+    /// Invokes the given function for every contiguous chunk of entities in the view.
+    ///
+    /// The function is called as function(entityCount, entities, components...), where entities and each of
+    /// the component pointers address entityCount contiguous elements. For filtered views, chunks are split
+    /// into the contiguous runs of entities passing the filters.
+    /// @param[in] chunkFunction the function to invoke for each chunk.
+    template<class ChunkFunction>
+    inline void ForEachChunk(ChunkFunction&& chunkFunction) const
+    {
+        for (auto* archetype: mArchetypes)
+        {
+            const auto entityCount = archetype->GetEntityCount();
 
-using ComponentMask   = std::bitset<MAX_COMPONENTS>;
-using ComponentTypeId = int;
-using SystemTypeId    = int;
-using EntityId        = long long;
+            for (std::size_t chunkStartRow = 0U; chunkStartRow < entityCount; chunkStartRow += ARCHETYPE_CHUNK_CAPACITY)
+            {
+                const auto chunkEndRow = std::min(chunkStartRow + ARCHETYPE_CHUNK_CAPACITY, entityCount);
+                if (mChangeFilters.empty())
+                {
+                    InvokeForRun(*archetype, chunkStartRow, chunkEndRow - chunkStartRow, chunkFunction);
+                    continue;
+                }
 
-///------------------------------------------------------------------------------------------------
+                auto runStartRow = chunkStartRow;
+                for (auto row = chunkStartRow; row < chunkEndRow; ++row)
+                {
+                    if (!PassesChangeFilters(*archetype, row))
+                    {
+                        InvokeForRun(*archetype, runStartRow, row - runStartRow, chunkFunction);
+                        runStartRow = row + 1;
+                    }
+                }
 
-struct ComponentTypeIdHasher
-{
-    std::size_t operator()(const ComponentTypeId& key) const
+                InvokeForRun(*archetype, runStartRow, chunkEndRow - runStartRow, chunkFunction);
+            }
+        }
+    }
+
+    /// Invokes the given function for every entity in the view.
+    ///
+    /// The function is called as function(entityId, components...) with references to the entity's components.
+    /// @param[in] function the function to invoke for each entity.
+    template<class Function>
+    inline void ForEach(Function&& function) const
     {
-        return static_cast<std::size_t>(key);
+        ForEachChunk([&function](const std::size_t entityCount, const EntityId* entities, ComponentTypes*... components)
+        {
+            for (std::size_t i = 0U; i < entityCount; ++i)
+            {
+                function(entities[i], components[i]...);
+            }
+        });
     }
-};
 
-struct EntityIdHasher
-{
-    std::size_t operator()(const EntityId& key) const
+    /// Invokes the given function for every entity in the view, processing each chunk of the view
+    /// as a separate job. Returns once all entities have been processed.
+    ///
+    /// The function is invoked concurrently from multiple threads, so it must only mutate the
+    /// components of the entity it is invoked with.
+    /// @param[in] function the function to invoke for each entity. @see ForEach()
+    template<class Function>
+    inline void ParallelForEach(Function&& function) const
     {
-        return static_cast<std::size_t>(key);
+        auto& jobSystem = jobs::JobSystem::GetInstance();
+        if (jobSystem.GetWorkerThreadCount() == 0U)
+        {
+            ForEach(std::forward<Function>(function));
+            return;
+        }
+
+        jobs::JobCounter counter;
+        ForEachChunk([&jobSystem, &counter, &function](const std::size_t entityCount, const EntityId* entities, ComponentTypes*... components)
+        {
+            jobSystem.ScheduleJob([&function, entityCount, entities, components...]()
+            {
+                for (std::size_t i = 0U; i < entityCount; ++i)
+                {
+                    function(entities[i], components[i]...);
+                }
+            }, counter);
+        });
+
+        jobSystem.WaitForCounter(counter);
     }
-};
 
-///------------------------------------------------------------------------------------------------
-/// Base class of all components in the engine. All custom components needs to inherit from
-/// this class.
-class IComponent
-{     
-public:
-    IComponent() = default;
-    virtual ~IComponent() = default;
-    
-    IComponent(const IComponent&) = delete;
-    IComponent& operator=(const IComponent&) = delete;
-    
-};
+private:
+    // Stamps the non-const viewed components of the given run of rows as changed, and passes the run to the given function
+    template<class ChunkFunction>
+    inline void InvokeForRun(Archetype& archetype, const std::size_t runStartRow, const std::size_t runEntityCount, ChunkFunction& chunkFunction) const
+    {
+        if (runEntityCount == 0U)
+        {
+            return;
+        }
 
-///------------------------------------------------------------------------------------------------
-/// To be used when a system doesn't care about any component types in its update
-class NullComponent final: public IComponent
-{
+        (StampChanged<ComponentTypes>(archetype, runStartRow, runEntityCount), ...);
+
+        chunkFunction
+        (
+            runEntityCount,
+            archetype.GetEntities().data() + runStartRow,
+            &archetype.template GetComponent<ComponentTypes>(GetComponentTypeId<ComponentTypes>(), runStartRow)...
+        );
+    }
+
+    template<class ComponentType>
+    inline void StampChanged(Archetype& archetype, const std::size_t runStartRow, const std::size_t runEntityCount) const
+    {
+        if constexpr (!std::is_const<ComponentType>::value)
+        {
+            std::fill_n(archetype.GetChangeTickAddress(GetComponentTypeId<ComponentType>(), runStartRow), runEntityCount, mChangeTick);
+        }
+    }
+
+    inline bool PassesChangeFilters(Archetype& archetype, const std::size_t row) const
+    {
+        for (const auto& changeFilter: mChangeFilters)
+        {
+            if (!IsChangeTickNewer(*archetype.GetChangeTickAddress(changeFilter.mComponentTypeId, row), changeFilter.mSinceTick))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    const std::vector<Archetype*> mArchetypes;
+    const std::vector<ChangeFilter> mChangeFilters;
+    const ChangeTick mChangeTick;
 };
 
 ///------------------------------------------------------------------------------------------------
 /// The kernel of the ECS engine. Manages all registered systems and entities.
+///
+/// Worlds share no ECS state with each other (component type ids are the only process-wide data, and these
+/// are handed out thread-safely), and the engine's entity helpers (MeshUtils, FontUtils, LightUtils) take the
+/// world to operate on explicitly, so systems only ever touch the world passed to them through GetWorld().
+/// Engine services (resource loading, sound, scripting) are process-wide and not thread-safe though, so
+/// worlds may only be updated concurrently when at most one of them uses these services.
 class World final
 {
 public:     
-    /// The default method of getting a hold of this singleton.
+    /// Reserves space for the anticipated entity count and creates the empty archetype.
+    World();
+
+    World(const World&) = delete;
+    const World& operator = (const World&) = delete;
+
+    /// Gets the engine's main world, which the engine's global facilities (the rendering, input and font utilities,
+    /// the console commands and the exported scripting functions) operate on.
     ///
-    /// The single instance of this class will be lazily initialized
-    /// the first time it is needed.
-    /// @returns a reference to the single instance of this class.    
+    /// The main world will be lazily initialized the first time it is needed.
+    /// @returns a reference to the engine's main world.
     static World& GetInstance();
 
-    /// @returns a map containing the system name strings mapped to their current update times in miliseconds.
-    const tsl::robin_map<StringId, long long, StringIdHasher>& GetSystemUpdateTimes() const;
+    /// The names of the systems double as the names of their update profile scopes \see profiling::Profiler::GetScopeStatistics()
+    /// @returns the names of all systems in the order they were added.
+    std::vector<StringId> GetSystemNames() const;
 
-    /// Performs a single update of the world simulation.
-    /// @param[in] dt the inter-frame delta time in seconds.
-    void Update(const float dt);
+    /// Performs a single update of the systems of the given update phase.
+    /// @param[in] dt the delta time in seconds since the previous update of the same phase.
+    /// @param[in] updatePhase the phase whose systems are updated.
+    void Update(const float dt, const SystemUpdatePhase updatePhase = SystemUpdatePhase::SIMULATION);
 
     /// Adds a system to the world and takes ownership of it
     /// @param[in] system the system instance to add to the world and take ownership over.
@@ -130,12 +1083,20 @@ public:
     /// Should be used before accessing components of entities indirectly; e.g.
     /// in a system that uses components that store entity id references
     /// @param[in] entityId the entity id to check for.
-    bool HasEntity(const EntityId entityId) const;
+    inline bool HasEntity(const EntityId entityId) const
+    {
+        const auto entityIndex = GetEntityIndex(entityId);
+        return entityIndex < mEntityRecords.size() &&
+            mEntityRecords[entityIndex].mGeneration == GetEntityGeneration(entityId) &&
+            mEntityRecords[entityIndex].mArchetype != nullptr;
+    }
     
     /// Removes the given entity from the world.
     ///
-    /// Internally simply clears the component store for the given entity since all entities
-    /// with no attached components will be cleaned up at the beginning of the next frame.
+    /// Internally removes all components of the given entity and moves it to the empty archetype. The entity
+    /// is queued for reclamation at the beginning of the next frame, after which its id is no longer valid.
+    /// The destruction of its components is deferred and batched across frames.
+    /// @see MAX_DEFERRED_COMPONENT_DESTRUCTIONS_PER_UPDATE
     /// @param[in] entityId the entity with this id will be destroyed.
     void DestroyEntity(const EntityId entityId);
     
@@ -144,6 +1105,8 @@ public:
     void DestroyEntities(const std::vector<EntityId>& entityIds);
     
     /// Finds and returns the first entity found with the name provided.
+    ///
+    /// Names are looked up in an index of all NameComponents, so the cost does not depend on the entity count.
     /// @param[in] name the name to search for the entities with.
     /// @returns the entity id of the entity found, or NULL_ENTITY_ID otherwise
     EntityId FindEntityWithName(const StringId& entityName) const;
@@ -161,6 +1124,8 @@ public:
     ///
     /// The accessor will fail silently if the entity does not have a component of the respective component class.
     /// Always test for component ownership, unless certain that the entity has one. @see HasComponent() before using this method
+    ///
+    /// Unless ComponentType is const-qualified, the component is stamped as changed.
     /// @tparam ComponentType the derived component type class to poll the entity for.
     /// @param[in] entityId the entity with the respective id to get the component from.
     /// @returns the component with the respective component type belonging to this entity.
@@ -170,16 +1135,60 @@ public:
         assert(entityId != NULL_ENTITY_ID &&
             "Requested a component from NULL_ENTITY_ID");
 
-        assert(mEntityComponentStore.count(entityId) != 0 &&
+        assert(HasEntity(entityId) &&
             "Entity does not exist in the world");
 
-        const auto componentTypeId = GetTypeHash<ComponentType>();
-        const auto& entityEntry = mEntityComponentStore.at(entityId);
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
+        const auto& entityRecord = mEntityRecords[GetEntityIndex(entityId)];
 
-        assert(entityEntry.mComponents[componentTypeId] &&
+        assert(entityRecord.mArchetype->GetComponentMask()[componentTypeId] &&
             "Component is not present in this entity's component store");
         
-        return static_cast<ComponentType&>(*entityEntry.mComponents[componentTypeId]);
+        // Mutable access is assumed to change the component
+        if constexpr (!std::is_const<ComponentType>::value)
+        {
+            *entityRecord.mArchetype->GetChangeTickAddress(componentTypeId, entityRecord.mRow) = mChangeTick;
+        }
+        
+        return entityRecord.mArchetype->GetComponent<ComponentType>(componentTypeId, entityRecord.mRow);
+    }
+
+    /// Creates a view over all entities that own (at least) the given component types.
+    ///
+    /// The view can be further restricted to entities whose components have changed, e.g.
+    /// View<const TransformComponent>(Changed<TransformComponent>{ sinceTick }). Entities also need to own
+    /// the component types of all change filters.
+    /// @tparam ComponentTypes the component type classes that the viewed entities need to own (optionally const-qualified).
+    /// @tparam ChangedComponentTypes the component type classes of the change filters.
+    /// @param[in] changeFilters the change filters that the viewed entities need to pass (all of them).
+    /// @returns a view over all matching entities.
+    template<class... ComponentTypes, class... ChangedComponentTypes>
+    [[nodiscard]] inline ComponentView<ComponentTypes...> View(const Changed<ChangedComponentTypes>&... changeFilters) const
+    {
+        auto viewComponentMask = ComponentView<ComponentTypes...>::GetComponentMask();
+        (viewComponentMask.Set(GetComponentTypeId<ChangedComponentTypes>()), ...);
+
+        std::vector<Archetype*> matchingArchetypes;
+        for (const auto& archetype: mArchetypes)
+        {
+            if (archetype->GetComponentMask().Contains(viewComponentMask))
+            {
+                matchingArchetypes.push_back(archetype.get());
+            }
+        }
+
+        return ComponentView<ComponentTypes...>
+        (
+            std::move(matchingArchetypes),
+            mChangeTick,
+            { typename ComponentView<ComponentTypes...>::ChangeFilter{ GetComponentTypeId<ChangedComponentTypes>(), changeFilters.mSinceTick }... }
+        );
+    }
+
+    /// @returns the current world tick, used to stamp changed components. @see ChangeTick
+    [[nodiscard]] inline ChangeTick GetChangeTick() const
+    {
+        return mChangeTick;
     }
 
     /// Checks whether the given entity has a component of the given component class type.
@@ -192,36 +1201,218 @@ public:
         assert(entityId != NULL_ENTITY_ID &&
             "Component check from NULL_ENTITY_ID");
 
-        assert(mEntityComponentStore.count(entityId) != 0 &&
+        assert(HasEntity(entityId) &&
             "Entity does not exist in the world");
 
-        const auto componentTypeId = GetTypeHash<ComponentType>();
-        return mEntityComponentStore.at(entityId).mComponents[componentTypeId] != nullptr;
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
+        return mEntityRecords[GetEntityIndex(entityId)].mArchetype->GetComponentMask()[componentTypeId];
     }
 
-    /// Adds and <b>takes ownership</b> of the given component and adds it to the entity with the given id.
-    /// @tparam ComponentType the derived component type.
-    /// @param[in] entityId the entity with the respective id to check component ownership from.
-    /// @param[in] component the pointer to the component instance to be added to the entity.
+    /// Registers the given component class with the world, recording its layout (size, alignment and
+    /// whether it is trivially copyable) and creating its chunk pool. Component types are also registered
+    /// lazily on their first addition to an entity, so calling this up front is only needed to query the
+    /// type's layout before then. Registering a type multiple times is harmless.
+    ///
+    /// Trivially copyable component types are relocated with memcpy and are never explicitly destroyed.
+    /// @tparam ComponentType the derived component type class to register.
+    /// @returns the component type id of the given component class.
+    template<class ComponentType>
+    inline ComponentTypeId RegisterComponentType()
+    {
+        static_assert(std::is_base_of<IComponent, ComponentType>::value,
+            "ComponentType does not derive from IComponent");
+
+        static_assert(std::is_move_constructible<ComponentType>::value,
+            "ComponentType needs to be move constructible to be stored in the archetype tables");
+
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
+        if (componentTypeId >= static_cast<ComponentTypeId>(mComponentChunkPools.size()))
+        {
+            mComponentChunkPools.resize(componentTypeId + 1);
+        }
+
+        if (mComponentChunkPools[componentTypeId] == nullptr)
+        {
+            mComponentChunkPools[componentTypeId] = std::make_unique<ComponentChunkPool>(GetComponentTypeInfo<ComponentType>());
+        }
+        
+        return componentTypeId;
+    }
+
+    /// Gets the layout of a registered component type.
+    /// @param[in] componentTypeId the type id of the registered component class.
+    /// @returns the type info recorded when the component type was registered.
+    inline const ComponentTypeInfo& GetRegisteredComponentTypeInfo(const ComponentTypeId componentTypeId) const
+    {
+        assert(componentTypeId < static_cast<ComponentTypeId>(mComponentChunkPools.size()) && mComponentChunkPools[componentTypeId] != nullptr &&
+            "Component type has not been registered");
+
+        return mComponentChunkPools[componentTypeId]->GetTypeInfo();
+    }
+
+    /// Creates an index over all components of the given type, keyed by the given extractor function.
+    /// Entities already owning such a component are indexed right away. Only one index per component type is supported.
+    /// @tparam ComponentType the derived component type class to index.
+    /// @tparam KeyType the type of the keys extracted from the components.
+    /// @tparam KeyHasher the hasher of the keys.
+    /// @param[in] keyExtractor the function extracting the key of each indexed component.
+    /// @returns the created index.
+    template<class ComponentType, class KeyType, class KeyHasher = std::hash<KeyType>>
+    inline const ComponentIndex<ComponentType, KeyType, KeyHasher>& AddComponentIndex(typename ComponentIndex<ComponentType, KeyType, KeyHasher>::KeyExtractor keyExtractor)
+    {
+        const auto componentTypeId = RegisterComponentType<ComponentType>();
+        if (componentTypeId >= static_cast<ComponentTypeId>(mComponentIndices.size()))
+        {
+            mComponentIndices.resize(componentTypeId + 1);
+        }
+
+        assert(mComponentIndices[componentTypeId] == nullptr &&
+            "An index already exists for this component type");
+
+        auto componentIndex = std::make_unique<ComponentIndex<ComponentType, KeyType, KeyHasher>>(keyExtractor);
+        for (const auto& archetype: mArchetypes)
+        {
+            if (archetype->GetComponentMask()[componentTypeId])
+            {
+                const auto& entities = archetype->GetEntities();
+                for (auto row = 0U; row < entities.size(); ++row)
+                {
+                    componentIndex->VOnComponentAdded(entities[row], archetype->GetComponentAddress(componentTypeId, row));
+                }
+            }
+        }
+
+        const auto& componentIndexRef = *componentIndex;
+        mComponentIndices[componentTypeId] = std::move(componentIndex);
+        mIndexedComponentMask.Set(componentTypeId);
+
+        return componentIndexRef;
+    }
+
+    /// Gets the index previously created for the given component type. @see AddComponentIndex()
+    /// @tparam ComponentType the derived component type class of the index.
+    /// @tparam KeyType the type of the index's keys.
+    /// @tparam KeyHasher the hasher of the index's keys.
+    /// @returns the index of the given component type.
+    template<class ComponentType, class KeyType, class KeyHasher = std::hash<KeyType>>
+    [[nodiscard]] inline const ComponentIndex<ComponentType, KeyType, KeyHasher>& GetComponentIndex() const
+    {
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
+        assert(mIndexedComponentMask[componentTypeId] &&
+            "No index exists for this component type");
+
+        return static_cast<const ComponentIndex<ComponentType, KeyType, KeyHasher>&>(*mComponentIndices[componentTypeId]);
+    }
+
+    /// Registers an observer notified of every addition of a component of the given type.
+    ///
+    /// Additions are notified in order at the next flush point (@see ObserverId), provided the entity
+    /// still owns the component by then, so the observer gets to see the component's current state.
+    /// @tparam ComponentType the derived component type class to observe.
+    /// @param[in] observer the function invoked with the entity and its added component.
+    /// @returns the id of the observer, to be used for its removal.
+    template<class ComponentType>
+    inline ObserverId OnAdd(std::function<void(const EntityId, const ComponentType&)> observer)
+    {
+        return AddObserver<ComponentType>(ObserverEventType::ADD, [observer](const EntityId entityId, const void* component)
+        {
+            observer(entityId, *static_cast<const ComponentType*>(component));
+        });
+    }
+
+    /// Registers an observer notified of every removal of a component of the given type, including
+    /// the ones caused by entity destructions.
+    ///
+    /// Removals are notified in order at the next flush point (@see ObserverId). The component has
+    /// already been destroyed by then, so only the entity it was removed from is passed to the observer.
+    /// @tparam ComponentType the derived component type class to observe.
+    /// @param[in] observer the function invoked with the entity the component was removed from.
+    /// @returns the id of the observer, to be used for its removal.
+    template<class ComponentType>
+    inline ObserverId OnRemove(std::function<void(const EntityId)> observer)
+    {
+        return AddObserver<ComponentType>(ObserverEventType::REMOVE, [observer](const EntityId entityId, const void*)
+        {
+            observer(entityId);
+        });
+    }
+
+    /// Registers an observer notified at the end of every world update (i.e. per update phase and per
+    /// simulation tick, so potentially several times per frame) of every component of the given type
+    /// that has been added or mutably accessed since the previous notification. @see ChangeTick
+    ///
+    /// Changes are detected by scanning the change ticks of the archetypes holding the component type,
+    /// so only types that have change observers pay for the scan.
+    /// @tparam ComponentType the derived component type class to observe.
+    /// @param[in] observer the function invoked with each entity and its changed component.
+    /// @returns the id of the observer, to be used for its removal.
     template<class ComponentType>
-    inline void AddComponent(const EntityId entityId, std::unique_ptr<IComponent> component)
+    inline ObserverId OnChange(std::function<void(const EntityId, const ComponentType&)> observer)
+    {
+        return AddObserver<ComponentType>(ObserverEventType::CHANGE, [observer](const EntityId entityId, const void* component)
+        {
+            observer(entityId, *static_cast<const ComponentType*>(component));
+        });
+    }
+
+    /// Removes a previously registered observer. It is safe to remove observers from within observers.
+    /// @param[in] observerId the id of the observer to remove.
+    void RemoveObserver(const ObserverId observerId);
+
+    /// Constructs a component of the given type in place, directly in the entity's component storage.
+    ///
+    /// The returned reference is only valid until the next structural change of the entity's archetype
+    /// (i.e. the next entity creation, destruction, component addition or removal).
+    /// @tparam ComponentType the derived component type class to construct.
+    /// @param[in] entityId the entity with the respective id to add the component to.
+    /// @param[in] args the arguments forwarded to the component's constructor.
+    /// @returns the newly constructed component.
+    template<class ComponentType, class... ArgTypes, class = std::enable_if_t<!IsSingleUniquePtrArgument<ArgTypes...>::value>>
+    inline ComponentType& AddComponent(const EntityId entityId, ArgTypes&&... args)
     {
         assert(entityId != NULL_ENTITY_ID &&
             "Component addition for NULL_ENTITY_ID");
 
-        assert(mEntityComponentStore.count(entityId) != 0 &&
+        assert(HasEntity(entityId) &&
             "Entity does not exist in the world");
 
-        const auto componentTypeId = GetTypeHash<ComponentType>();
+        const auto componentTypeId = RegisterComponentType<ComponentType>();
 
-        auto& entityEntry = mEntityComponentStore.at(entityId);
-        assert(entityEntry.mComponents[componentTypeId] == nullptr &&
+        auto& entityRecord = mEntityRecords[GetEntityIndex(entityId)];
+        assert(entityRecord.mArchetype->GetComponentMask()[componentTypeId] == false &&
             "Component is already present in this entity's component store");
         
-        entityEntry.mComponents[componentTypeId] = std::move(component);
-        entityEntry.mMask |= 1 << componentTypeId;
+        // The component is constructed into its target row while the entity's current row is still intact,
+        // so the arguments may reference the entity's other components (allocating the row never relocates
+        // stored components, as columns grow by whole chunks). Only then are the remaining components moved over
+        auto& targetArchetype = GetArchetypeWithAddedComponent(*entityRecord.mArchetype, componentTypeId);
+        const auto targetRow  = targetArchetype.AllocateRow(entityId);
+
+        auto* component = new (targetArchetype.GetComponentAddress(componentTypeId, targetRow)) ComponentType(std::forward<ArgTypes>(args)...);
+        MoveEntityToArchetypeRow(entityId, entityRecord, targetArchetype, targetRow);
+        *targetArchetype.GetChangeTickAddress(componentTypeId, targetRow) = mChangeTick;
         
-        OnEntityChanged(entityId, entityEntry.mMask);
+        if (mIndexedComponentMask[componentTypeId])
+        {
+            mComponentIndices[componentTypeId]->VOnComponentAdded(entityId, component);
+        }
+
+        QueueObserverEvent(ObserverEventType::ADD, componentTypeId, entityId);
+        OnEntityChanged(entityId);
+        return *component;
+    }
+
+    /// Adds and <b>takes ownership</b> of the given component and adds it to the entity with the given id.
+    ///
+    /// Prefer constructing the component in place instead, to avoid the intermediate heap allocation.
+    /// @tparam ComponentType the derived component type.
+    /// @param[in] entityId the entity with the respective id to check component ownership from.
+    /// @param[in] component the pointer to the component instance to be added to the entity.
+    template<class ComponentType>
+    inline void AddComponent(const EntityId entityId, std::unique_ptr<ComponentType> component)
+    {
+        // The heap allocated instance is relocated into the archetype's column and freed along with the unique_ptr
+        AddComponent<ComponentType>(entityId, std::move(*component));
     }
 
     /// Removes the component with the given type from the entity with the given entity id.
@@ -233,19 +1424,20 @@ public:
         assert(entityId != NULL_ENTITY_ID &&
             "Component removal from NULL_ENTITY_ID");
 
-        assert(mEntityComponentStore.count(entityId) != 0 &&
+        assert(HasEntity(entityId) &&
             "Entity does not exist in the world");
 
-        const auto componentTypeId = GetTypeHash<ComponentType>();
-        auto& entityEntry = mEntityComponentStore.at(entityId);
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
+        auto& entityRecord = mEntityRecords[GetEntityIndex(entityId)];
 
-        assert(entityEntry.mComponents[componentTypeId] &&
+        assert(entityRecord.mArchetype->GetComponentMask()[componentTypeId] &&
             "Component is not present in this entity's component store");
         
-        entityEntry.mComponents[componentTypeId] = nullptr;
-        entityEntry.mMask ^= 1 << componentTypeId;
+        // The removed component is destroyed when moving to an archetype without its column
+        auto& targetArchetype = GetArchetypeWithRemovedComponent(*entityRecord.mArchetype, componentTypeId);
+        MoveEntityToArchetype(entityId, entityRecord, targetArchetype);
         
-        OnEntityChanged(entityId, entityEntry.mMask);
+        OnEntityChanged(entityId);
     }
     
     /// Get the registered singleton component with the given type.
@@ -257,7 +1449,7 @@ public:
         static_assert(std::is_base_of<IComponent, ComponentType>::value,
             "ComponentType does not derive from IComponent");
 
-        const auto componentTypeId = GetTypeHash<ComponentType>();
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
         return static_cast<ComponentType&>(*mSingletonComponents.at(componentTypeId));
     }
 
@@ -270,7 +1462,7 @@ public:
         static_assert(std::is_base_of<IComponent, ComponentType>::value,
             "ComponentType does not derive from IComponent");
 
-        const auto componentTypeId = GetTypeHash<ComponentType>();
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
         return mSingletonComponents.count(componentTypeId) != 0;
     }    
 
@@ -280,16 +1472,20 @@ public:
     /// @tparam ComponentType the singleton component type class to take ownership of.
     /// @param[in] component the singleton component instance to take ownership of.
     template<class ComponentType>
-    inline void SetSingletonComponent(std::unique_ptr<IComponent> component)
+    inline void SetSingletonComponent(std::unique_ptr<ComponentType> component)
     {
         static_assert(std::is_base_of<IComponent, ComponentType>::value,
             "ComponentType does not derive from IComponent");
 
-        const auto componentTypeId = GetTypeHash<ComponentType>();
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
         assert(mSingletonComponents.count(componentTypeId) == 0 &&
             "A Singleton component of the specified type already exists in the world");
 
-        mSingletonComponents[componentTypeId] = std::move(component);
+        // IComponent has no virtual destructor, so the singleton is deleted through its concrete type
+        mSingletonComponents.emplace(componentTypeId, SingletonComponentPtr(component.release(), [](IComponent* singletonComponent)
+        {
+            delete static_cast<ComponentType*>(singletonComponent);
+        }));
     }
 
     /// Removes the singleton component with the respective type from the world.    
@@ -300,7 +1496,7 @@ public:
         static_assert(std::is_base_of<IComponent, ComponentType>::value,
             "ComponentType does not derive from IComponent");
                 
-        const auto componentTypeId = GetTypeHash<ComponentType>();
+        const auto componentTypeId = GetComponentTypeId<ComponentType>();
         assert(mSingletonComponents.count(componentTypeId) != 0 &&
             "A Singleton component of the specified type does not exist");
 
@@ -310,67 +1506,328 @@ public:
     /// Calculates the bit mask of the given template arguments.
     /// @tparam FirstUtilizedComponentType a component's type class
     template<class FirstUtilizedComponentType>
-    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask()
+    [[nodiscard]] static inline ComponentMask CalculateComponentUsageMask()
     {
         static_assert(std::is_base_of<IComponent, FirstUtilizedComponentType>::value,
             "Attempted to extract mask from class not derived from IComponent");
         
-        return 1 << GetTypeHash<FirstUtilizedComponentType>();
+        ComponentMask componentMask;
+        componentMask.Set(GetComponentTypeId<FirstUtilizedComponentType>());
+        return componentMask;
     }
 
     /// Calculates the bit mask of the given template arguments.
     /// @tparam FirstUtilizedComponentType a component's type class
     /// @tparam SecondUtilizedComponentType a component's type class
     template<class FirstUtilizedComponentType, class SecondUtilizedComponentType, class ...RestUtilizedComponentTypes>
-    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask()
+    [[nodiscard]] static inline ComponentMask CalculateComponentUsageMask()
     {
         static_assert(std::is_base_of<IComponent, FirstUtilizedComponentType>::value,
             "Attempted to extract mask from class not derived from IComponent");
 
-        const auto componentTypeId = GetTypeHash<FirstUtilizedComponentType>();
-
-        return ComponentMask(1 << componentTypeId) |
+        return CalculateComponentUsageMask<FirstUtilizedComponentType>() |
             CalculateComponentUsageMask<SecondUtilizedComponentType, RestUtilizedComponentTypes...>();
     }
     
-    /// Explicit specialization for NullComponent to return a full component mask.
-    template<>
-    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask<NullComponent>()
-    {
-        return ~ComponentMask();
-    }
-
 private:        
-    /// Reserves space for the anticipated entity count.
-    World();
+    /// Gets (or lazily creates) the archetype storing entities with the given component mask.
+    /// @param[in] componentMask the component mask of the archetype.
+    /// @returns the archetype with the given component mask.
+    Archetype& GetOrCreateArchetype(const ComponentMask& componentMask);
+
+    /// Gets the archetype reached by adding the given component type to the given archetype.
+    /// @param[in] archetype the archetype to start from.
+    /// @param[in] componentTypeId the component type id to add.
+    /// @returns the archetype with the resulting component mask.
+    Archetype& GetArchetypeWithAddedComponent(Archetype& archetype, const ComponentTypeId componentTypeId);
 
-    /// Removes all entities with no components currently attached to them.
-    void RemoveEntitiesWithoutAnyComponents();
+    /// Gets the archetype reached by removing the given component type from the given archetype.
+    /// @param[in] archetype the archetype to start from.
+    /// @param[in] componentTypeId the component type id to remove.
+    /// @returns the archetype with the resulting component mask.
+    Archetype& GetArchetypeWithRemovedComponent(Archetype& archetype, const ComponentTypeId componentTypeId);
+
+    /// Frees the slots of all entities destroyed since the last reclamation, unless components were added back to them since.
+    void ReclaimDestroyedEntities();
+
+    /// Groups the systems of each update phase into update stages. Systems are placed in the stage after the latest
+    /// stage containing an earlier-added system of the same phase they conflict with, so all systems of a stage can be
+    /// updated concurrently while the outcome stays the same as updating them in insertion order.
+    void RebuildSystemUpdateStages();
+
+    /// Updates the system with the given index and records its update time.
+    /// @param[in] systemIndex the index of the system to update.
+    /// @param[in] dt the inter-frame delta time in seconds.
+    void UpdateSystem(const std::size_t systemIndex, const float dt);
     
-    /// Adjusts the systems' entities to process accordingly
+    /// Queues the given entity for a system membership update. Multiple changes of the same
+    /// entity are collapsed into a single update. @see ProcessPendingEntityChanges()
     /// @param[in] entityId the entity that has changed
-    /// @param[in] newComponentMask the new component mask of the entity
-    void OnEntityChanged(const EntityId entityId, const ComponentMask& newComponentMask);
-    
+    void OnEntityChanged(const EntityId entityId);
+
+    /// Adjusts the systems' entities to process according to the current component masks of all changed entities.
+    void ProcessPendingEntityChanges();
+
+private:
+    enum class ObserverEventType
+    {
+        ADD, REMOVE, CHANGE
+    };
+
+    using ObserverFunction = std::function<void(const EntityId, const void*)>;
+
+    struct Observer
+    {
+        ObserverId mId;
+        ObserverEventType mEventType;
+        ComponentTypeId mComponentTypeId;
+        ObserverFunction mFunction;
+    };
+
+    struct ObserverEvent
+    {
+        ObserverEventType mEventType;
+        ComponentTypeId mComponentTypeId;
+        EntityId mEntityId;
+    };
+
+    /// Registers a type-erased observer for the given component type and event type.
+    /// @tparam ComponentType the derived component type class to observe.
+    /// @param[in] eventType the type of events to observe.
+    /// @param[in] observerFunction the function invoked with each observed entity and (type-erased) component.
+    /// @returns the id of the observer.
+    template<class ComponentType>
+    inline ObserverId AddObserver(const ObserverEventType eventType, ObserverFunction observerFunction)
+    {
+        const auto componentTypeId = RegisterComponentType<ComponentType>();
+        const auto observerId = mNextObserverId++;
+
+        mObservers.push_back(std::make_unique<Observer>(Observer{ observerId, eventType, componentTypeId, std::move(observerFunction) }));
+        GetObservedComponentMask(eventType).Set(componentTypeId);
+
+        return observerId;
+    }
+
+    /// @param[in] eventType the type of observer events.
+    /// @returns the mask of component types having observers for the given type of events.
+    ComponentMask& GetObservedComponentMask(const ObserverEventType eventType);
+
+    /// Queues an addition or removal event for the observers of the given component type, if any.
+    /// @param[in] eventType the type of the event.
+    /// @param[in] componentTypeId the type id of the added or removed component.
+    /// @param[in] entityId the entity the component was added to or removed from.
+    inline void QueueObserverEvent(const ObserverEventType eventType, const ComponentTypeId componentTypeId, const EntityId entityId)
+    {
+        if (GetObservedComponentMask(eventType)[componentTypeId])
+        {
+            mPendingObserverEvents.push_back(ObserverEvent{ eventType, componentTypeId, entityId });
+        }
+    }
+
+    /// Invokes the observers of the given event.
+    /// @param[in] eventType the type of the event.
+    /// @param[in] componentTypeId the type id of the component the event refers to.
+    /// @param[in] entityId the entity the event refers to.
+    /// @param[in] component the address of the component, or nullptr for removal events.
+    void InvokeObservers(const ObserverEventType eventType, const ComponentTypeId componentTypeId, const EntityId entityId, const void* component);
+
+    /// Notifies the observers of all queued component additions and removals, including the ones
+    /// caused by the observers themselves.
+    void DispatchPendingObserverEvents();
+
+    /// Notifies the change observers of all components changed since the previous dispatch.
+    void DispatchChangeObserverEvents();
+
+    /// Discards the observers removed during a dispatch, once it is safe to do so.
+    void CompactObservers();
+
 private:
-    struct EntityEntry
+    struct EntityRecord
     {
-        std::array<std::unique_ptr<IComponent>, MAX_COMPONENTS> mComponents;
-        ComponentMask mMask;
+        Archetype* mArchetype         = nullptr;
+        std::size_t mRow              = 0U;
+        EntityGeneration mGeneration  = INITIAL_ENTITY_GENERATION;
+        bool mHasPendingChanges       = false;
+        bool mIsPendingReclamation    = false;
     };
 
-    using EntityComponentStoreMap = tsl::robin_map<EntityId, EntityEntry, EntityIdHasher>;
-    using ComponentMap = tsl::robin_map<ComponentTypeId, std::unique_ptr<IComponent>, ComponentTypeIdHasher>;
+    /// Moves the entity's components to the given archetype. Components not present in the target
+    /// archetype are destroyed, while the ones only present in the target archetype are left unconstructed.
+    /// @param[in] entityId the entity to move.
+    /// @param[in] entityRecord the storage record of the entity, updated to point to its new row.
+    /// @param[in] targetArchetype the archetype to move the entity to.
+    /// @param[in] deferComponentDestruction whether the removed components are queued for deferred destruction instead.
+    /// @returns the row of the entity in the target archetype.
+    std::size_t MoveEntityToArchetype(const EntityId entityId, EntityRecord& entityRecord, Archetype& targetArchetype, const bool deferComponentDestruction = false);
+
+    /// Moves the entity's components to an already allocated row of the given archetype. @see MoveEntityToArchetype()
+    /// @param[in] entityId the entity to move.
+    /// @param[in] entityRecord the storage record of the entity, updated to point to its new row.
+    /// @param[in] targetArchetype the archetype to move the entity to.
+    /// @param[in] targetRow the row allocated for the entity in the target archetype.
+    /// @param[in] deferComponentDestruction whether the removed components are queued for deferred destruction instead.
+    void MoveEntityToArchetypeRow(const EntityId entityId, EntityRecord& entityRecord, Archetype& targetArchetype, const std::size_t targetRow, const bool deferComponentDestruction = false);
+
+private:
+    using ArchetypeMap          = tsl::robin_map<ComponentMask, Archetype*, ComponentMaskHasher>;
+    using SingletonComponentPtr = std::unique_ptr<IComponent, void(*)(IComponent*)>;
+    using ComponentMap          = tsl::robin_map<ComponentTypeId, SingletonComponentPtr, ComponentTypeIdHasher>;
     
-    EntityComponentStoreMap mEntityComponentStore;
-    ComponentMap            mSingletonComponents;
-               
-    tsl::robin_map<StringId, long long, StringIdHasher> mSystemUpdateToDuration;
-    tsl::robin_map<std::type_index, std::vector<EntityId>> mEntitiesToUpdatePerSystem;
+    // Dense entity storage indexed by entity index. Slots with a null archetype are free for reuse
+    std::vector<EntityRecord> mEntityRecords;
+    std::vector<EntityIndex> mFreeEntityIndices;
+    std::vector<EntityId> mEntitiesPendingReclamation;
+    ComponentMap mSingletonComponents;
+
+    // Declared before the archetypes, so that the pools outlive the columns releasing chunks to them
+    std::vector<std::unique_ptr<ComponentChunkPool>> mComponentChunkPools;
+    std::vector<std::unique_ptr<IComponentIndex>> mComponentIndices;
+    ComponentMask mIndexedComponentMask;
+    ChangeTick mChangeTick = 1U;
+
+    // Observers are heap allocated so that they stay put while observers register further observers
+    std::vector<std::unique_ptr<Observer>> mObservers;
+    std::vector<ObserverEvent> mPendingObserverEvents;
+    ComponentMask mObservedAddComponentMask;
+    ComponentMask mObservedRemoveComponentMask;
+    ComponentMask mObservedChangeComponentMask;
+    ChangeTick mLastObservedChangeTick = 0U;
+    ObserverId mNextObserverId = NULL_OBSERVER_ID + 1;
+    std::size_t mObserverDispatchDepth = 0U;
+    bool mHasRemovedObservers = false;
+
+    std::vector<std::unique_ptr<Archetype>> mArchetypes;
+    ArchetypeMap mArchetypesByMask;
+    DeferredComponentDestructionQueue mDeferredComponentDestructionQueue;
+    Archetype* mEmptyArchetype = nullptr;
     
     std::vector<std::unique_ptr<ISystem>> mSystems;
+    std::array<std::vector<std::vector<std::size_t>>, static_cast<std::size_t>(SystemUpdatePhase::COUNT)> mSystemUpdateStages;
+    std::vector<EntitySparseSet> mEntitiesToUpdatePerSystem;
+    std::vector<EntityId> mPendingEntityChanges;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Explicit specialization for NullComponent to return a full component mask.
+template<>
+[[nodiscard]] inline ComponentMask World::CalculateComponentUsageMask<NullComponent>()
+{
+    return ~ComponentMask();
+}
+
+///------------------------------------------------------------------------------------------------
+/// Records structural changes (entity creations and destructions, component additions and removals)
+/// to be applied to the world later on, as a single batch.
+///
+/// Recording is thread-safe, so a system's jobs can all record to the same buffer. Entities created
+/// through the buffer get a temporary (negative) id that can be used in subsequent commands of the
+/// same buffer, and that is resolved to the actual entity id on playback.
+///
+/// Components to be added are kept in a linear arena owned by the buffer until playback, after which
+/// the arena is reset, so recording component additions every frame does not allocate in the steady state.
+class EntityCommandBuffer final
+{
+public:
+    EntityCommandBuffer();
+    ~EntityCommandBuffer();
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    const EntityCommandBuffer& operator = (const EntityCommandBuffer&) = delete;
+
+    /// Records the creation of an entity.
+    /// @returns the temporary id of the entity to be created, only valid for commands of this buffer.
+    EntityId CreateEntity();
+
+    /// Records the destruction of the given entity.
+    /// @param[in] entityId the (existing or temporary) id of the entity to destroy.
+    void DestroyEntity(const EntityId entityId);
+
+    /// Records the addition of a component, constructed in place from the given arguments, to the given entity.
+    /// @tparam ComponentType the derived component type class of the component to add.
+    /// @param[in] entityId the (existing or temporary) id of the entity to add the component to.
+    /// @param[in] args the arguments forwarded to the component's constructor.
+    template<class ComponentType, class... ArgTypes, class = std::enable_if_t<!IsSingleUniquePtrArgument<ArgTypes...>::value>>
+    inline void AddComponent(const EntityId entityId, ArgTypes&&... args)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        
+        auto* component = new (mComponentArena.Allocate(sizeof(ComponentType), alignof(ComponentType))) ComponentType(std::forward<ArgTypes>(args)...);
+        mCommands.push_back(Command
+        {
+            CommandType::ADD_COMPONENT,
+            entityId,
+            component,
+            &GetComponentTypeInfo<ComponentType>(),
+            [](World& world, const EntityId targetEntityId, void* targetComponent)
+            {
+                world.AddComponent<ComponentType>(targetEntityId, std::move(*static_cast<ComponentType*>(targetComponent)));
+            }
+        });
+    }
+
+    /// Records the addition of the given component to the given entity.
+    /// @tparam ComponentType the derived component type class of the component to add.
+    /// @param[in] entityId the (existing or temporary) id of the entity to add the component to.
+    /// @param[in] component the component to add.
+    template<class ComponentType>
+    inline void AddComponent(const EntityId entityId, std::unique_ptr<ComponentType> component)
+    {
+        AddComponent<ComponentType>(entityId, std::move(*component));
+    }
+
+    /// Records the removal of the component with the given type from the given entity.
+    /// @tparam ComponentType the derived component type class of the component to remove.
+    /// @param[in] entityId the (existing or temporary) id of the entity to remove the component from.
+    template<class ComponentType>
+    inline void RemoveComponent(const EntityId entityId)
+    {
+        RecordCommand(Command
+        {
+            CommandType::REMOVE_COMPONENT,
+            entityId,
+            nullptr,
+            nullptr,
+            [](World& world, const EntityId targetEntityId, void*)
+            {
+                world.RemoveComponent<ComponentType>(targetEntityId);
+            }
+        });
+    }
+
+    /// @returns whether the buffer has no recorded commands.
+    bool IsEmpty() const;
+
+    /// Applies all recorded commands to the given world, in the order they were recorded, and clears the buffer.
+    ///
+    /// Commands targeting entities that no longer exist by the time of playback are skipped.
+    /// @param[in] world the world to apply the commands to.
+    void Playback(World& world);
+
+private:
+    using ComponentCommandFunction = void(*)(World&, const EntityId, void* component);
+
+    enum class CommandType
+    {
+        CREATE_ENTITY, DESTROY_ENTITY, ADD_COMPONENT, REMOVE_COMPONENT
+    };
+
+    struct Command
+    {
+        CommandType mType;
+        EntityId mEntityId;
+        void* mComponent;
+        const ComponentTypeInfo* mComponentTypeInfo;
+        ComponentCommandFunction mComponentCommandFunction;
+    };
+
+    /// Appends the given command to the buffer.
+    /// @param[in] command the command to append.
+    void RecordCommand(Command command);
 
-    EntityId mEntityCounter = 1LL;
+private:
+    mutable std::mutex mMutex;
+    std::vector<Command> mCommands;
+    std::size_t mPendingEntityCount = 0U;
+    LinearArena mComponentArena;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -379,10 +1836,77 @@ class ISystem
 {
     friend class World;
 public:
-    ISystem() = default;
+    /// @param[in] world the world the system will be added to, and operate on.
+    explicit ISystem(World& world)
+        : mWorld(world)
+    {
+    }
+
     virtual ~ISystem() = default;
     ISystem(const ISystem&) = delete;
     const ISystem& operator = (const ISystem&) = delete;
+
+protected:
+    /// @returns the world the system operates on.
+    inline World& GetWorld() const
+    {
+        return mWorld;
+    }
+
+    /// Declares that the system reads the given (entity or singleton) component types.
+    ///
+    /// Systems that only access disjoint data can be updated concurrently by the world, so every component
+    /// access beyond the system's utilized component types needs to be declared.
+    /// @tparam ComponentTypes the component type classes read by the system.
+    template<class... ComponentTypes>
+    inline void DeclareReadAccess()
+    {
+        (mReadAccessMask.Set(GetComponentTypeId<ComponentTypes>()), ...);
+    }
+
+    /// Declares that the system reads and writes the given (entity or singleton) component types.
+    /// @tparam ComponentTypes the component type classes written by the system.
+    template<class... ComponentTypes>
+    inline void DeclareWriteAccess()
+    {
+        (mWriteAccessMask.Set(GetComponentTypeId<ComponentTypes>()), ...);
+        (mReadAccessMask.Set(GetComponentTypeId<ComponentTypes>()), ...);
+    }
+
+    /// Declares that the system creates or destroys entities, or adds or removes components. Such systems
+    /// are updated exclusively on the main thread, with no other system running alongside them.
+    inline void DeclareStructuralChanges()
+    {
+        mPerformsStructuralChanges = true;
+    }
+
+    /// Forces the system to be updated on the main thread, e.g. for systems using the GL context.
+    inline void PinToMainThread()
+    {
+        mIsPinnedToMainThread = true;
+    }
+
+    /// Sets the phase of the frame the system is updated in. Needs to be called before the system is added to the world.
+    /// @param[in] updatePhase the update phase of the system.
+    inline void SetUpdatePhase(const SystemUpdatePhase updatePhase)
+    {
+        mUpdatePhase = updatePhase;
+    }
+
+    /// Gets the system's command buffer. Structural changes recorded to it are applied by the world as a single
+    /// batch once the system's update stage completes, so systems recording to it do not need to declare them.
+    /// @returns the command buffer of this system.
+    inline EntityCommandBuffer& GetCommandBuffer() const
+    {
+        return mCommandBuffer;
+    }
+
+    /// @returns the world tick of the system's previous update (or 0 if it has not been updated yet), to be
+    /// used for restricting views to components changed since then. @see Changed
+    inline ChangeTick GetLastUpdateTick() const
+    {
+        return mLastUpdateTick;
+    }
     
 private:
     [[nodiscard]] virtual inline bool ShouldProcessComponentMask(const ComponentMask& componentMask) const = 0;
@@ -391,31 +1915,94 @@ private:
     /// @param[in] dt the delta-time in seconds that has elapsed since the last frame
     /// @param[in] entitiesToProcess the entities that match this system's signature (mask) and that should be processed
     virtual void VUpdate(const float dt, const std::vector<EntityId>& entitiesToProcess) const = 0;
+
+    /// Checks whether this system and the given one can not be updated concurrently.
+    /// @param[in] other the system to check against.
+    /// @returns whether the two systems' declared accesses conflict.
+    [[nodiscard]] inline bool ConflictsWith(const ISystem& other) const
+    {
+        return
+            mPerformsStructuralChanges ||
+            other.mPerformsStructuralChanges ||
+            mWriteAccessMask.Intersects(other.mReadAccessMask) ||
+            mReadAccessMask.Intersects(other.mWriteAccessMask);
+    }
     
 private:
+    World& mWorld;
     StringId mSystemName;
+    const char* mProfileScopeName = nullptr;
+    mutable EntityCommandBuffer mCommandBuffer;
+    ComponentMask mReadAccessMask;
+    ComponentMask mWriteAccessMask;
+    bool mPerformsStructuralChanges = false;
+    bool mIsPinnedToMainThread = false;
+    SystemUpdatePhase mUpdatePhase = SystemUpdatePhase::SIMULATION;
+    ChangeTick mLastUpdateTick = 0U;
 };
 
 ///------------------------------------------------------------------------------------------------
 /// Base class of all systems in the ECS engine. All systems need to inherit from this class.
+///
+/// Const-qualified utilized component types are declared as read-only accesses of the system,
+/// while the rest are declared as read-write accesses.
 template<class... UtilizedComponentTypes>
 class BaseSystem: public ISystem
 {
 public:
-    BaseSystem()
-        : mComponentUsageMask(World::GetInstance().CalculateComponentUsageMask<UtilizedComponentTypes...>())
+    /// @param[in] world the world the system will be added to, and operate on.
+    explicit BaseSystem(World& world)
+        : ISystem(world)
+        , mComponentUsageMask(World::CalculateComponentUsageMask<std::remove_const_t<UtilizedComponentTypes>...>())
     {
+        (DeclareUtilizedComponentAccess<UtilizedComponentTypes>(), ...);
     }
         
     virtual ~BaseSystem() = default;
     BaseSystem(const BaseSystem&) = delete;
     const BaseSystem& operator = (const BaseSystem&) = delete;  
+
+protected:
+    /// Creates a view over all entities matching this system's utilized component types.
+    /// @returns a view yielding the utilized components of all entities processed by this system.
+    [[nodiscard]] inline ComponentView<UtilizedComponentTypes...> GetView() const
+    {
+        return GetWorld().View<UtilizedComponentTypes...>();
+    }
+
+    /// Creates a view over the entities matching this system's utilized component types, whose components
+    /// of all the given types have changed since the system's previous update.
+    /// @tparam ChangedComponentTypes the component type classes that need to have changed.
+    /// @returns a view yielding the utilized components of the changed entities processed by this system.
+    template<class... ChangedComponentTypes>
+    [[nodiscard]] inline ComponentView<UtilizedComponentTypes...> GetChangedView() const
+    {
+        return GetWorld().View<UtilizedComponentTypes...>(Changed<ChangedComponentTypes>{ GetLastUpdateTick() }...);
+    }
         
 private:
+    // Declares the access of the given utilized component type based on its const qualification
+    template<class UtilizedComponentType>
+    inline void DeclareUtilizedComponentAccess()
+    {
+        if constexpr (std::is_same<std::remove_const_t<UtilizedComponentType>, NullComponent>::value)
+        {
+            return;
+        }
+        else if constexpr (std::is_const<UtilizedComponentType>::value)
+        {
+            DeclareReadAccess<std::remove_const_t<UtilizedComponentType>>();
+        }
+        else
+        {
+            DeclareWriteAccess<UtilizedComponentType>();
+        }
+    }
+
     // Determines whether the given component mask should be processed by this system
     [[nodiscard]] inline bool ShouldProcessComponentMask(const ComponentMask& componentMask) const override
     {
-        return (componentMask & mComponentUsageMask) == mComponentUsageMask;
+        return componentMask.Contains(mComponentUsageMask);
     };
 
 private:
@@ -64,6 +64,20 @@ struct GameStartupParameters
     const float mGameWindowScreenFraction;
     const int mGameWindowWidth;
     const int mGameWindowHeight;
+    
+    /// Whether the engine should run without a window, GL context, audio device or input polling.
+    ///
+    /// In this mode only the simulation runs, with its ticks executed back to back rather than
+    /// paced by the frame rate. The window related parameters above are ignored.
+    bool mIsHeadless = false;
+    
+    /// The number of simulation ticks after which a headless run exits (0 runs indefinitely).
+    long long mHeadlessSimulationTickCount = 0;
+    
+    /// The local TCP port that engine metrics are served on, in the Prometheus text format (0 disables telemetry).
+    ///
+    /// The metrics can be scraped from http://127.0.0.1:<port>/, e.g. by curl or a Prometheus agent.
+    int mTelemetryPort = 0;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 ///------------------------------------------------------------------------------------------------
 
 #include "GenesisEngine.h"
+#include "common/components/PreviousTransformComponent.h"
 #include "common/components/TransformComponent.h"
 #include "common/utils/Logging.h"
 #include "common/utils/MathUtils.h"
@@ -16,6 +17,9 @@
 #include "input/components/InputStateSingletonComponent.h"
 #include "input/systems/RawInputHandlingSystem.h"
 #include "input/utils/InputUtils.h"
+#include "profiling/Profiler.h"
+#include "rendering/components/CameraSingletonComponent.h"
+#include "rendering/components/RenderingContextSingletonComponent.h"
 #include "rendering/components/WindowSingletonComponent.h"
 #include "rendering/systems/RenderingSystem.h"
 #include "rendering/utils/FontUtils.h"
@@ -23,11 +27,15 @@
 #include "scripting/service/LuaScriptingService.h"
 #include "scripting/DefaultEngineExportableFunctions.h"
 #include "sound/SoundService.h"
+#include "telemetry/TelemetryService.h"
 #include "../game/scene/scenegraphs/QuadtreeSceneGraph.h"
 
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
 #include <SDL.h> 
 #include <SDL_events.h> 
-#include <SDL_timer.h>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -41,6 +49,12 @@ namespace
     const StringId CONSOLE_FONT_NAME  = StringId("console_font");
     const int CONSOLE_FONT_ATLAS_COLS = 16;
     const int CONSOLE_FONT_ATLAS_ROWS = 16;
+    
+    const float SIMULATION_TICK_DURATION       = 1.0f/60.0f;
+    const int MAX_SIMULATION_TICKS_PER_FRAME   = 5;
+    
+    const std::string FRAME_TIME_HISTOGRAM_NAME           = "genesis_frame_time_milliseconds";
+    const std::string SIMULATION_TICK_TIME_HISTOGRAM_NAME = "genesis_simulation_tick_time_milliseconds";
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -59,21 +73,77 @@ void GenesisEngine::RunGame(const GameStartupParameters& startupParameters, IGam
 {
     Initialize(startupParameters);
 
-    game.VOnSystemsInit();
+    auto& world = ecs::World::GetInstance();
+    
+    // Headless runs render nothing, so there is nothing to interpolate either
+    if (!startupParameters.mIsHeadless)
+    {
+        InitializeTransformInterpolation();
+    }
+    
+    game.VOnSystemsInit(startupParameters);
+    
+    if (startupParameters.mIsHeadless)
+    {
+        game.VOnGameInit();
+        RunHeadlessSimulation(startupParameters.mHeadlessSimulationTickCount, game);
+        return;
+    }
+    
     InitializeDefaultConsoleFont();
     debug::RegisterDefaultEngineConsoleCommands();
     game.VOnGameInit();
 
-    auto dt                = 0.0f;
-    auto elapsedTicks      = 0.0f;
-    auto dtAccumulator     = 0.0f;
-    auto framesAccumulator = 0LL; 
+    auto dtAccumulator         = 0.0f;
+    auto framesAccumulator     = 0LL;
+    auto simulationAccumulator = 0.0f;
+    auto lastFrameTimePoint    = std::chrono::steady_clock::now();
 
+    auto& profiler = profiling::Profiler::GetInstance();
+    auto& telemetryService = telemetry::TelemetryService::GetInstance();
+    
     while (!AppShouldQuit())
     {        
-        UpdateFrameStatistics(dt, elapsedTicks, dtAccumulator, framesAccumulator);
-        game.VOnUpdate(dt);
-        ecs::World::GetInstance().Update(dt);        
+        // The timings of the previous frame, including that of its own scope, are complete by now
+        profiler.CollectEvents();
+        GENESIS_PROFILE_SCOPE("Frame");
+        
+        const auto frameTimePoint = std::chrono::steady_clock::now();
+        const auto dt = std::chrono::duration<float>(frameTimePoint - lastFrameTimePoint).count();
+        lastFrameTimePoint = frameTimePoint;
+        
+        if (telemetryService.IsEnabled())
+        {
+            telemetryService.RecordHistogramSample(FRAME_TIME_HISTOGRAM_NAME, dt * 1000.0f);
+        }
+        
+        UpdateFrameStatistics(dt, dtAccumulator, framesAccumulator);
+        
+        // The simulation advances in fixed ticks, so that its cost and outcome do not depend on the frame rate
+        simulationAccumulator += dt;
+        auto simulationTickCount = 0;
+        while (simulationAccumulator >= SIMULATION_TICK_DURATION && simulationTickCount < MAX_SIMULATION_TICKS_PER_FRAME)
+        {
+            GENESIS_PROFILE_SCOPE("SimulationTick");
+            const auto simulationDt = IsSimulationPaused() ? 0.0f : SIMULATION_TICK_DURATION;
+            
+            SnapshotTransformsForInterpolation();
+            game.VOnUpdate(simulationDt);
+            world.Update(simulationDt, ecs::SystemUpdatePhase::SIMULATION);
+            
+            simulationAccumulator -= SIMULATION_TICK_DURATION;
+            ++simulationTickCount;
+        }
+        
+        // When the simulation can not keep up, the backlog is dropped instead of snowballing over the next frames
+        simulationAccumulator = std::min(simulationAccumulator, SIMULATION_TICK_DURATION);
+        
+        if (world.HasSingletonComponent<rendering::RenderingContextSingletonComponent>())
+        {
+            world.GetSingletonComponent<rendering::RenderingContextSingletonComponent>().mSimulationInterpolationFactor = simulationAccumulator/SIMULATION_TICK_DURATION;
+        }
+        
+        world.Update(dt, ecs::SystemUpdatePhase::PRESENTATION);
     }
 }
 
@@ -81,8 +151,16 @@ void GenesisEngine::RunGame(const GameStartupParameters& startupParameters, IGam
 
 void GenesisEngine::Initialize(const GameStartupParameters& startupParameters)
 {       
-    InitializeSdlContextAndWindow(startupParameters);
-    InitializeServices();    
+    if (startupParameters.mIsHeadless)
+    {
+        InitializeNullInput();
+    }
+    else
+    {
+        InitializeSdlContextAndWindow(startupParameters);
+    }
+    
+    InitializeServices(startupParameters);
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -148,37 +226,54 @@ void GenesisEngine::InitializeSdlContextAndWindow(const GameStartupParameters& s
 
 ///-----------------------------------------------------------------------------------------------
 
-void GenesisEngine::InitializeServices() const
+void GenesisEngine::InitializeNullInput() const
+{
+    // An input state that is never polled, leaving every action permanently released
+    ecs::World::GetInstance().SetSingletonComponent<input::InputStateSingletonComponent>(std::make_unique<input::InputStateSingletonComponent>());
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GenesisEngine::InitializeServices(const GameStartupParameters& startupParameters) const
 {
     resources::ResourceLoadingService::GetInstance().Initialize();
-    sound::SoundService::GetInstance().Initialize();
+    
+    if (startupParameters.mIsHeadless)
+    {
+        sound::SoundService::GetInstance().InitializeNullBackend();
+    }
+    else
+    {
+        sound::SoundService::GetInstance().Initialize();
+    }
+    
     scripting::LuaScriptingService::GetInstance().Initialize();
     scripting::BindDefaultEngineFunctionsToLua();
+    
+    if (startupParameters.mTelemetryPort > 0)
+    {
+        telemetry::TelemetryService::GetInstance().Initialize(startupParameters.mTelemetryPort);
+    }
 }
 
 ///-----------------------------------------------------------------------------------------------
 
 void GenesisEngine::InitializeDefaultConsoleFont() const
 {
-    rendering::LoadFont(CONSOLE_FONT_NAME, CONSOLE_FONT_ATLAS_COLS, CONSOLE_FONT_ATLAS_ROWS);
+    rendering::LoadFont(ecs::World::GetInstance(), CONSOLE_FONT_NAME, CONSOLE_FONT_ATLAS_COLS, CONSOLE_FONT_ATLAS_ROWS);
 }
 
 ///-----------------------------------------------------------------------------------------------
 
-void GenesisEngine::UpdateFrameStatistics(float& dt, float& elapsedTicks, float& dtAccumulator, long long& framesAccumulator) const
+void GenesisEngine::UpdateFrameStatistics(const float dt, float& dtAccumulator, long long& framesAccumulator) const
 {
-    // Calculate frame delta
-    const auto currentTicks = static_cast<float>(SDL_GetTicks());
-    const auto lastFrameTicks = currentTicks - elapsedTicks;
-
-    elapsedTicks = currentTicks;
-    dt = lastFrameTicks * 0.001f;
-
     framesAccumulator++;
     dtAccumulator += dt;
 
     if (dtAccumulator > 1.0f)
     {     
+        PublishTelemetry(framesAccumulator/dtAccumulator);
+        
 #if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
         auto& world = ecs::World::GetInstance();
         if (world.HasSingletonComponent<debug::DebugViewStateSingletonComponent>())
@@ -186,24 +281,177 @@ void GenesisEngine::UpdateFrameStatistics(float& dt, float& elapsedTicks, float&
             world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>().mCurrentFps = static_cast<int>(framesAccumulator);
         }            
         Log(LogType::INFO, (std::string("FPS: ") + std::to_string(framesAccumulator) + " | Entities: " + std::to_string(world.GetEntityCount())).c_str());
+        if (world.HasSingletonComponent<rendering::RenderingContextSingletonComponent>())
+        {
+            const auto& renderingContextComponent = world.GetSingletonComponent<rendering::RenderingContextSingletonComponent>();
+            Log(LogType::INFO, "Draw calls: %d (instances: %d) | Shader binds: %d | Texture binds: %d | Mesh binds: %d | Material uploads: %d", renderingContextComponent.mDrawCallCount, renderingContextComponent.mInstanceCount, renderingContextComponent.mShaderBindCount, renderingContextComponent.mTextureBindCount, renderingContextComponent.mMeshBindCount, renderingContextComponent.mMaterialUploadCount);
+        }
 #endif
         
         framesAccumulator = 0;
         dtAccumulator = 0.0f;
     }        
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GenesisEngine::RunHeadlessSimulation(const long long simulationTickCount, IGame& game) const
+{
+    assert(simulationTickCount >= 0 &&
+        "Negative headless simulation tick count");
     
-    // Make sure the console system has been registered at all
-    if (ecs::World::GetInstance().HasSingletonComponent<debug::ConsoleStateSingletonComponent>() == false)
+    auto& world = ecs::World::GetInstance();
+    auto& profiler = profiling::Profiler::GetInstance();
+    auto& telemetryService = telemetry::TelemetryService::GetInstance();
+    
+    const auto startTimePoint = std::chrono::steady_clock::now();
+    auto reportTimePoint      = startTimePoint;
+    auto previousTickTimePoint = startTimePoint;
+    auto ticksSinceReport     = 0LL;
+    auto tick                 = 0LL;
+    
+    // Ticks are not paced by the frame rate, so the simulation advances as fast as the machine allows. The
+    // tick duration stays fixed however, so that the outcome matches that of a windowed run.
+    for (; simulationTickCount == 0 || tick < simulationTickCount; ++tick)
+    {
+        profiler.CollectEvents();
+        
+        {
+            GENESIS_PROFILE_SCOPE("SimulationTick");
+            game.VOnUpdate(SIMULATION_TICK_DURATION);
+            world.Update(SIMULATION_TICK_DURATION, ecs::SystemUpdatePhase::SIMULATION);
+        }
+        
+        ++ticksSinceReport;
+        const auto tickTimePoint = std::chrono::steady_clock::now();
+        if (telemetryService.IsEnabled())
+        {
+            telemetryService.RecordHistogramSample(SIMULATION_TICK_TIME_HISTOGRAM_NAME, std::chrono::duration<double, std::milli>(tickTimePoint - previousTickTimePoint).count());
+        }
+        previousTickTimePoint = tickTimePoint;
+        
+        const auto secondsSinceReport = std::chrono::duration<float>(tickTimePoint - reportTimePoint).count();
+        if (secondsSinceReport > 1.0f)
+        {
+            PublishTelemetry(ticksSinceReport/secondsSinceReport);
+            Log(LogType::INFO, "Ticks/s: %.1f | Entities: %zu", ticksSinceReport/secondsSinceReport, world.GetEntityCount());
+            reportTimePoint  = tickTimePoint;
+            ticksSinceReport = 0;
+        }
+    }
+    
+    // Printed regardless of the build configuration, since throughput is measured on release builds
+    const auto totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTimePoint).count();
+    std::printf("Headless simulation: %lld ticks in %.3fs (%.1f ticks/s, %.3fms/tick)\n", tick, totalSeconds, tick/totalSeconds, 1000.0 * totalSeconds/tick);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GenesisEngine::PublishTelemetry(const float updatesPerSecond) const
+{
+    auto& telemetryService = telemetry::TelemetryService::GetInstance();
+    if (!telemetryService.IsEnabled())
     {
         return;
     }
+    
+    const auto& world = ecs::World::GetInstance();
+    telemetryService.SetGauge("genesis_updates_per_second", updatesPerSecond);
+    telemetryService.SetGauge("genesis_entity_count", static_cast<double>(world.GetEntityCount()));
+    telemetryService.SetGauge("genesis_loaded_resource_bytes", static_cast<double>(resources::ResourceLoadingService::GetInstance().GetLoadedResourceByteCount()));
+    
+    if (world.HasSingletonComponent<rendering::RenderingContextSingletonComponent>())
+    {
+        const auto& renderingContextComponent = world.GetSingletonComponent<rendering::RenderingContextSingletonComponent>();
+        telemetryService.SetGauge("genesis_draw_calls", renderingContextComponent.mDrawCallCount);
+        telemetryService.SetGauge("genesis_instanced_draw_instances", renderingContextComponent.mInstanceCount);
+        telemetryService.SetGauge("genesis_binds{state=\"shader\"}", renderingContextComponent.mShaderBindCount);
+        telemetryService.SetGauge("genesis_binds{state=\"texture\"}", renderingContextComponent.mTextureBindCount);
+        telemetryService.SetGauge("genesis_binds{state=\"mesh\"}", renderingContextComponent.mMeshBindCount);
+        telemetryService.SetGauge("genesis_binds{state=\"material\"}", renderingContextComponent.mMaterialUploadCount);
+    }
+    
+    // The rolling percentiles of the profiler double as the per system update time metrics
+    const auto& profiler = profiling::Profiler::GetInstance();
+    for (const auto& systemName: world.GetSystemNames())
+    {
+        const auto systemStatistics = profiler.GetScopeStatistics(systemName);
+        const auto systemLabel      = "{system=\"" + systemName.GetString() + "\"}";
+        telemetryService.SetGauge("genesis_system_update_p50_microseconds" + systemLabel, systemStatistics.mP50Microseconds);
+        telemetryService.SetGauge("genesis_system_update_p99_microseconds" + systemLabel, systemStatistics.mP99Microseconds);
+    }
+    
+    telemetryService.Publish();
+}
 
-    auto& consoleStateComponent = ecs::World::GetInstance().GetSingletonComponent<debug::ConsoleStateSingletonComponent>();
+///------------------------------------------------------------------------------------------------
+
+bool GenesisEngine::IsSimulationPaused() const
+{
+    // Make sure the console system has been registered at all
+    if (ecs::World::GetInstance().HasSingletonComponent<debug::ConsoleStateSingletonComponent>() == false)
+    {
+        return false;
+    }
 
     // Freeze dt in case the console is opened
-    if (consoleStateComponent.mEnabled)
+    return ecs::World::GetInstance().GetSingletonComponent<debug::ConsoleStateSingletonComponent>().mEnabled;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GenesisEngine::InitializeTransformInterpolation() const
+{
+    auto& world = ecs::World::GetInstance();
+    
+    // Newly added transforms have no previous tick to be interpolated from, so they start off from their current state
+    world.OnAdd<TransformComponent>([&world](const ecs::EntityId entityId, const TransformComponent& transformComponent)
+    {
+        // Copied up front, as adding the previous transform relocates the entity's components
+        PreviousTransformComponent previousTransformComponent;
+        previousTransformComponent.mPosition = transformComponent.mPosition;
+        previousTransformComponent.mRotation = transformComponent.mRotation;
+        previousTransformComponent.mScale    = transformComponent.mScale;
+        
+        if (world.HasComponent<PreviousTransformComponent>(entityId))
+        {
+            world.GetComponent<PreviousTransformComponent>(entityId) = previousTransformComponent;
+        }
+        else
+        {
+            world.AddComponent<PreviousTransformComponent>(entityId, previousTransformComponent);
+        }
+    });
+    
+    world.OnRemove<TransformComponent>([&world](const ecs::EntityId entityId)
+    {
+        if (world.HasEntity(entityId) && world.HasComponent<PreviousTransformComponent>(entityId))
+        {
+            world.RemoveComponent<PreviousTransformComponent>(entityId);
+        }
+    });
+}
+
+///------------------------------------------------------------------------------------------------
+
+void GenesisEngine::SnapshotTransformsForInterpolation() const
+{
+    auto& world = ecs::World::GetInstance();
+    
+    // Only the previous transforms are accessed mutably, so the snapshot does not count as a change of every transform
+    world.View<const TransformComponent, PreviousTransformComponent>().ForEach([](const ecs::EntityId, const TransformComponent& transformComponent, PreviousTransformComponent& previousTransformComponent)
+    {
+        previousTransformComponent.mPosition = transformComponent.mPosition;
+        previousTransformComponent.mRotation = transformComponent.mRotation;
+        previousTransformComponent.mScale    = transformComponent.mScale;
+    });
+    
+    // The camera is moved by the game directly, so it is snapshotted alongside the transforms
+    if (world.HasSingletonComponent<rendering::CameraSingletonComponent>())
     {
-        dt = 0.0f;
+        auto& cameraComponent = world.GetSingletonComponent<rendering::CameraSingletonComponent>();
+        cameraComponent.mPreviousPosition    = cameraComponent.mPosition;
+        cameraComponent.mPreviousFrontVector = cameraComponent.mFrontVector;
     }
 }
 
@@ -27,6 +27,9 @@ public:
     GenesisEngine();
 
     /// Main game startup method
+    ///
+    /// Windowed runs return once the window is closed, and headless runs once the requested number of 
+    /// simulation ticks has been executed \see GameStartupParameters::mIsHeadless
     /// @param[in] startupParameters the parameters that determine the startup configuration of the engine.
     /// @param[in] game the reference to the IGame implementation to run.
     void RunGame(const GameStartupParameters& startupParameters, IGame& game);
@@ -34,9 +37,15 @@ public:
 private:
     void Initialize(const GameStartupParameters& startupParameters);
     void InitializeSdlContextAndWindow(const GameStartupParameters& startupParameters);    
-    void InitializeServices() const;
+    void InitializeNullInput() const;
+    void InitializeServices(const GameStartupParameters& startupParameters) const;
     void InitializeDefaultConsoleFont() const;
-    void UpdateFrameStatistics(float& dt, float& elapsedTicks, float& dtAccumulator, long long& framesAccumulator) const;
+    void RunHeadlessSimulation(const long long simulationTickCount, IGame& game) const;
+    void UpdateFrameStatistics(const float dt, float& dtAccumulator, long long& framesAccumulator) const;
+    void PublishTelemetry(const float updatesPerSecond) const;
+    bool IsSimulationPaused() const;
+    void InitializeTransformInterpolation() const;
+    void SnapshotTransformsForInterpolation() const;
 };
 
 }
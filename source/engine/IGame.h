@@ -10,6 +10,10 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include "GameStartupParameters.h"
+
+///------------------------------------------------------------------------------------------------
+
 namespace genesis
 {
 
@@ -26,7 +30,9 @@ public:
     /// This is the first initialization method to be called, and is 
     /// where all ecs systems used by the game should be initialized.
     /// The initialization order of the systems will also determine their order of execution.
-    virtual void VOnSystemsInit() = 0;
+    /// Headless runs should skip any systems that present to, or poll input from, the user.
+    /// @param[in] startupParameters the parameters the engine was started with.
+    virtual void VOnSystemsInit(const GameStartupParameters& startupParameters) = 0;
 
     /// Game initialization method. 
     ///
@@ -36,9 +42,9 @@ public:
 
     /// Game update method. 
     ///
-    /// This will be called once per frame and should be used to 
-    /// perform all game-specific logic.
-    /// @param[in] dt the inter-frame delta time.    
+    /// This will be called once per simulation tick (i.e. at a fixed rate, zero or more times
+    /// per frame) and should be used to perform all game-specific logic.
+    /// @param[in] dt the fixed simulation tick duration (0 while the simulation is paused).    
     virtual void VOnUpdate(const float dt) = 0;
 };
 
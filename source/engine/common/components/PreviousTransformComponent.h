@@ -0,0 +1,42 @@
+///------------------------------------------------------------------------------------------------
+///  PreviousTransformComponent.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef PreviousTransformComponent_h
+#define PreviousTransformComponent_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../ECS.h"
+#include "../utils/MathUtils.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+/// The transform of an entity as of the previous simulation tick, which rendering interpolates from.
+/// Kept apart from the TransformComponent so that snapshotting it does not mark every transform as changed.
+/// @see GenesisEngine::SnapshotTransformsForInterpolation()
+class PreviousTransformComponent final: public ecs::IComponent
+{
+public:
+    glm::vec3 mPosition = glm::vec3(0.0f, 0.0f, 0.0f);
+    glm::vec3 mRotation = glm::vec3(0.0f, 0.0f, 0.0f);
+    glm::vec3 mScale    = glm::vec3(1.0f, 1.0f, 1.0f);
+};
+
+// Snapshotted in bulk every simulation tick, so it needs to remain plain data like the TransformComponent
+static_assert(std::is_trivially_copyable<PreviousTransformComponent>::value, "PreviousTransformComponent needs to be trivially copyable");
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* PreviousTransformComponent_h */
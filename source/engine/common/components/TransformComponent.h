@@ -26,9 +26,11 @@ public:
     glm::vec3 mPosition = glm::vec3(0.0f, 0.0f, 0.0f);
     glm::vec3 mRotation = glm::vec3(0.0f, 0.0f, 0.0f);
     glm::vec3 mScale    = glm::vec3(1.0f, 1.0f, 1.0f);
-    
 };
 
+// Transforms are relocated with memcpy and updated in bulk, so they need to remain plain data
+static_assert(std::is_trivially_copyable<TransformComponent>::value, "TransformComponent needs to be trivially copyable");
+
 ///-----------------------------------------------------------------------------------------------
 
 }
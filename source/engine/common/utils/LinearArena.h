@@ -0,0 +1,107 @@
+///------------------------------------------------------------------------------------------------
+///  LinearArena.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef LinearArena_h
+#define LinearArena_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+///-----------------------------------------------------------------------------------------------
+/// A bump allocator for short-lived allocations. Allocations are carved sequentially out of
+/// fixed-size memory blocks and are never freed individually; instead the whole arena is reset
+/// at once, after which its blocks are reused for subsequent allocations.
+///
+/// The arena does not run any destructors, so objects constructed in it need to be destroyed
+/// by the client before the arena is reset.
+class LinearArena final
+{
+public:
+    ///-----------------------------------------------------------------------------------------------
+    /// @param[in] blockSize the size in bytes of each memory block of the arena.
+    explicit LinearArena(const std::size_t blockSize)
+        : mBlockSize(blockSize)
+        , mCurrentBlockIndex(0U)
+        , mCurrentBlockOffset(0U)
+    {
+    }
+
+    ///-----------------------------------------------------------------------------------------------
+    ~LinearArena()
+    {
+        for (const auto& block: mBlocks)
+        {
+            ::operator delete(block.mMemory);
+        }
+    }
+
+    LinearArena(const LinearArena&) = delete;
+    const LinearArena& operator = (const LinearArena&) = delete;
+
+    ///-----------------------------------------------------------------------------------------------
+    /// Allocates uninitialized memory from the arena.
+    /// @param[in] size the size of the allocation in bytes.
+    /// @param[in] alignment the alignment of the allocation. Needs to be a power of two.
+    /// @returns the address of the allocated memory, valid until the next Reset().
+    inline void* Allocate(const std::size_t size, const std::size_t alignment)
+    {
+        assert((alignment & (alignment - 1)) == 0 &&
+            "Allocation alignment is not a power of two");
+
+        while (mCurrentBlockIndex < mBlocks.size())
+        {
+            auto& block = mBlocks[mCurrentBlockIndex];
+            const auto blockAddress = reinterpret_cast<std::uintptr_t>(block.mMemory);
+            const auto alignedAddress = (blockAddress + mCurrentBlockOffset + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+
+            if (alignedAddress + size <= blockAddress + block.mSize)
+            {
+                mCurrentBlockOffset = alignedAddress + size - blockAddress;
+                return reinterpret_cast<void*>(alignedAddress);
+            }
+
+            ++mCurrentBlockIndex;
+            mCurrentBlockOffset = 0U;
+        }
+
+        // No reusable block has enough space left, so a new block (big enough for oversized allocations) is appended
+        const auto blockSize = std::max(mBlockSize, size + alignment);
+        mBlocks.push_back(Block{ static_cast<unsigned char*>(::operator new(blockSize)), blockSize });
+
+        return Allocate(size, alignment);
+    }
+
+    ///-----------------------------------------------------------------------------------------------
+    /// Invalidates all allocations made so far, making the arena's memory available for reuse.
+    inline void Reset()
+    {
+        mCurrentBlockIndex  = 0U;
+        mCurrentBlockOffset = 0U;
+    }
+
+private:
+    struct Block
+    {
+        unsigned char* mMemory;
+        std::size_t mSize;
+    };
+
+    const std::size_t mBlockSize;
+    std::vector<Block> mBlocks;
+    std::size_t mCurrentBlockIndex;
+    std::size_t mCurrentBlockOffset;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* LinearArena_h */
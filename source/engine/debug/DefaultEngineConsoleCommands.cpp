@@ -9,6 +9,7 @@
 #include "components/DebugViewStateSingletonComponent.h"
 #include "utils/ConsoleCommandUtils.h"
 #include "../common/components/TransformComponent.h"
+#include "../profiling/Profiler.h"
 
 #include <unordered_set>
 
@@ -98,6 +99,39 @@ void RegisterDefaultEngineConsoleCommands()
         return debug::ConsoleCommandResult(true);
     });
     
+    debug::RegisterConsoleCommand(StringId("profiler_capture"), [](const std::vector<std::string>& commandTextComponents)
+    {
+        static const std::unordered_set<std::string> sAllowedOptions = { "start", "stop" };
+        static const std::string DEFAULT_TRACE_FILE_PATH = "genesis_trace.json";
+
+        const std::string USAGE_STRING = "Usage: profiler_capture start|stop [trace_file_path]";
+
+        if (commandTextComponents.size() < 2 || commandTextComponents.size() > 3 || sAllowedOptions.count(StringToLower(commandTextComponents[1])) == 0)
+        {
+            return debug::ConsoleCommandResult(false, USAGE_STRING);
+        }
+
+        auto& profiler = profiling::Profiler::GetInstance();
+        if (StringToLower(commandTextComponents[1]) == "start")
+        {
+            profiler.StartCapture();
+            return debug::ConsoleCommandResult(true);
+        }
+
+        if (!profiler.IsCapturing())
+        {
+            return debug::ConsoleCommandResult(false, "No profiler capture is running");
+        }
+
+        const auto traceFilePath = commandTextComponents.size() == 3 ? commandTextComponents[2] : DEFAULT_TRACE_FILE_PATH;
+        if (!profiler.StopCaptureAndExportChromeTrace(traceFilePath))
+        {
+            return debug::ConsoleCommandResult(false, "Could not write " + traceFilePath);
+        }
+
+        return debug::ConsoleCommandResult(true, "Exported capture to " + traceFilePath);
+    });
+    
     debug::RegisterConsoleCommand(StringId("move_entity_by"), [](const std::vector<std::string>& commandTextComponents)
     {
         const std::string USAGE_STRING = "Usage: move_entity_by \"entity_name\" dx dy dz";
@@ -46,10 +46,11 @@ namespace
 
 ///-----------------------------------------------------------------------------------------------
 
-ConsoleManagementSystem::ConsoleManagementSystem()
-    : BaseSystem()
+ConsoleManagementSystem::ConsoleManagementSystem(ecs::World& world)
+    : BaseSystem(world)
 {       
-    ecs::World::GetInstance().SetSingletonComponent<ConsoleStateSingletonComponent>(std::make_unique<ConsoleStateSingletonComponent>());    
+    DeclareStructuralChanges();
+    GetWorld().SetSingletonComponent<ConsoleStateSingletonComponent>(std::make_unique<ConsoleStateSingletonComponent>());    
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -66,15 +67,15 @@ void ConsoleManagementSystem::VUpdate(const float, const std::vector<ecs::Entity
 
 void ConsoleManagementSystem::CreateConsoleBackgroundEntityIfNotAlive() const
 {
-    if (ecs::World::GetInstance().FindEntityWithName(CONSOLE_BACKGROUND_ENTITY_NAME) == ecs::NULL_ENTITY_ID)
+    if (GetWorld().FindEntityWithName(CONSOLE_BACKGROUND_ENTITY_NAME) == ecs::NULL_ENTITY_ID)
     {
-        rendering::LoadAndCreateGuiSprite("gui_base", "debug_square", StringId("console"), glm::vec3(0.0f, 0.0f, 0.0f), CONSOLE_BACKGROUND_ENTITY_NAME);
+        rendering::LoadAndCreateGuiSprite(GetWorld(), "gui_base", "debug_square", StringId("console"), glm::vec3(0.0f, 0.0f, 0.0f), CONSOLE_BACKGROUND_ENTITY_NAME);
     }
 }
 
 void ConsoleManagementSystem::HandleConsoleSpecialInput() const
 {
-    auto& consoleStateComponent = ecs::World::GetInstance().GetSingletonComponent<debug::ConsoleStateSingletonComponent>();
+    auto& consoleStateComponent = GetWorld().GetSingletonComponent<debug::ConsoleStateSingletonComponent>();
 
     // Handling console open/close
     if (input::IsActionTypeKeyTapped(input::InputActionType::CONSOLE_TOGGLE))
@@ -93,7 +94,7 @@ void ConsoleManagementSystem::HandleConsoleSpecialInput() const
 
             for (const auto& pastConsoleTextStringEntityIds : consoleStateComponent.mPastConsoleTextStringEntityIds)
             {
-                rendering::DestroyRenderedText(pastConsoleTextStringEntityIds);
+                rendering::DestroyRenderedText(GetWorld(), pastConsoleTextStringEntityIds);
             }
 
             consoleStateComponent.mPastConsoleTextStringEntityIds.clear();
@@ -142,7 +143,7 @@ void ConsoleManagementSystem::HandleConsoleSpecialInput() const
 
 void ConsoleManagementSystem::HandleConsoleBackgroundAnimation() const
 {
-    auto& consoleStateComponent = ecs::World::GetInstance().GetSingletonComponent<ConsoleStateSingletonComponent>();
+    auto& consoleStateComponent = GetWorld().GetSingletonComponent<ConsoleStateSingletonComponent>();
     if (consoleStateComponent.mEnabled)
     {
         // dt is not used in the opaqueness calculation since frozen when console opens
@@ -163,11 +164,16 @@ void ConsoleManagementSystem::HandleConsoleBackgroundAnimation() const
     }
 
     
-    const auto consoleBackgroundEntity = ecs::World::GetInstance().FindEntityWithName(CONSOLE_BACKGROUND_ENTITY_NAME);
+    const auto consoleBackgroundEntity = GetWorld().FindEntityWithName(CONSOLE_BACKGROUND_ENTITY_NAME);
     if (consoleBackgroundEntity != ecs::NULL_ENTITY_ID)
     {
-        auto& consoleBackgroundRenderableComponent = ecs::World::GetInstance().GetComponent<rendering::RenderableComponent>(consoleBackgroundEntity);
-        consoleBackgroundRenderableComponent.mShaderUniforms.mShaderFloatUniforms[CONSOLE_OPAQUENESS_UNIFORM_NAME] = consoleStateComponent.mBackgroundOpaqueness;
+        auto& consoleBackgroundRenderableComponent = GetWorld().GetComponent<rendering::RenderableComponent>(consoleBackgroundEntity);
+        if (consoleBackgroundRenderableComponent.mShaderParameters == nullptr)
+        {
+            consoleBackgroundRenderableComponent.mShaderParameters = std::make_shared<rendering::ShaderParameterBlock>();
+        }
+        
+        consoleBackgroundRenderableComponent.mShaderParameters->SetFloat(CONSOLE_OPAQUENESS_UNIFORM_NAME, consoleStateComponent.mBackgroundOpaqueness);
     }
 }
 
@@ -175,17 +181,18 @@ void ConsoleManagementSystem::HandleConsoleBackgroundAnimation() const
 
 void ConsoleManagementSystem::HandleConsoleTextRendering() const
 {
-    auto& consoleStateComponent = ecs::World::GetInstance().GetSingletonComponent<ConsoleStateSingletonComponent>();
+    auto& consoleStateComponent = GetWorld().GetSingletonComponent<ConsoleStateSingletonComponent>();
 
     if (consoleStateComponent.mCurrentCommandRenderedTextEntityId == ecs::NULL_ENTITY_ID || IsCurrentCommandRenderedTextOutOfDate())
     {
         if (consoleStateComponent.mCurrentCommandRenderedTextEntityId != ecs::NULL_ENTITY_ID)
         {
-            rendering::DestroyRenderedText(consoleStateComponent.mCurrentCommandRenderedTextEntityId);            
+            rendering::DestroyRenderedText(GetWorld(), consoleStateComponent.mCurrentCommandRenderedTextEntityId);            
         }
 
         consoleStateComponent.mCurrentCommandRenderedTextEntityId = rendering::RenderText
         (
+            GetWorld(),
             consoleStateComponent.mCurrentCommandTextBuffer,
             CONSOLE_TEXT_FONT_NAME,
             CONSOLE_TEXT_SIZE,
@@ -199,7 +206,7 @@ void ConsoleManagementSystem::HandleConsoleTextRendering() const
 
 void ConsoleManagementSystem::ExecuteCommand() const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     auto& consoleStateComponent = world.GetSingletonComponent<ConsoleStateSingletonComponent>();
         
     // Add command-to-be-executed to past console text
@@ -218,6 +225,7 @@ void ConsoleManagementSystem::ExecuteCommand() const
             // Render command not found text
             AddTextStringToConsolePastText(rendering::RenderText
             (
+                GetWorld(),
                 "Command not found.",
                 CONSOLE_TEXT_FONT_NAME,
                 CONSOLE_TEXT_SIZE, 
@@ -226,6 +234,7 @@ void ConsoleManagementSystem::ExecuteCommand() const
             ));
             AddTextStringToConsolePastText(rendering::RenderText
             (
+                GetWorld(),
                 "Type \"commands\" to see all available ones.",
                 CONSOLE_TEXT_FONT_NAME,
                 CONSOLE_TEXT_SIZE,
@@ -246,6 +255,7 @@ void ConsoleManagementSystem::ExecuteCommand() const
                 {
                     AddTextStringToConsolePastText(rendering::RenderText
                     (
+                        GetWorld(),
                         commandResultTextLine,
                         CONSOLE_TEXT_FONT_NAME,
                         CONSOLE_TEXT_SIZE,
@@ -269,7 +279,7 @@ void ConsoleManagementSystem::ExecuteCommand() const
 
 void ConsoleManagementSystem::AddTextStringToConsolePastText(const ecs::EntityId commandStringTextEntityId) const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     auto& consoleStateComponent = world.GetSingletonComponent<ConsoleStateSingletonComponent>();
 
     // Add text string to past console text
@@ -278,7 +288,7 @@ void ConsoleManagementSystem::AddTextStringToConsolePastText(const ecs::EntityId
     // Remove overflowing past text strings (circular buffer style)
     if (consoleStateComponent.mPastConsoleTextStringEntityIds.size() > CONSOLE_MAX_LINES_VISIBLE)
     {
-        rendering::DestroyRenderedText(consoleStateComponent.mPastConsoleTextStringEntityIds.front());
+        rendering::DestroyRenderedText(GetWorld(), consoleStateComponent.mPastConsoleTextStringEntityIds.front());
         consoleStateComponent.mPastConsoleTextStringEntityIds.erase(consoleStateComponent.mPastConsoleTextStringEntityIds.begin());
     }
 }
@@ -287,7 +297,7 @@ void ConsoleManagementSystem::AddTextStringToConsolePastText(const ecs::EntityId
 
 void ConsoleManagementSystem::AddCommandTextToCommandHistory(const std::string& commandText) const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     auto& consoleStateComponent = world.GetSingletonComponent<ConsoleStateSingletonComponent>();
 
     if (commandText.size() != 1)
@@ -301,7 +311,7 @@ void ConsoleManagementSystem::AddCommandTextToCommandHistory(const std::string&
 
 void ConsoleManagementSystem::RepositionPastConsoleTextStrings() const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     auto& consoleStateComponent = world.GetSingletonComponent<ConsoleStateSingletonComponent>();
 
     for (auto i = static_cast<int>(consoleStateComponent.mPastConsoleTextStringEntityIds.size()) - 1; i >= 0; --i)
@@ -315,7 +325,7 @@ void ConsoleManagementSystem::RepositionPastConsoleTextStrings() const
             CONSOLE_CURRENT_COMMAND_TEXT_POSITION.z
         );
 
-        rendering::SetTextPosition(pastConsoleTextStringEntityId, targetPosition);
+        rendering::SetTextPosition(GetWorld(), pastConsoleTextStringEntityId, targetPosition);
     }
 }
 
@@ -323,9 +333,9 @@ void ConsoleManagementSystem::RepositionPastConsoleTextStrings() const
 
 bool ConsoleManagementSystem::IsCurrentCommandRenderedTextOutOfDate() const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     const auto& consoleStateComponent = world.GetSingletonComponent<ConsoleStateSingletonComponent>();
-    const auto& renderedTextStringComponent = world.GetComponent<rendering::TextStringComponent>(consoleStateComponent.mCurrentCommandRenderedTextEntityId);
+    const auto& renderedTextStringComponent = world.GetComponent<const rendering::TextStringComponent>(consoleStateComponent.mCurrentCommandRenderedTextEntityId);
 
     std::string renderedCommandText = "";
     for (const auto& characterEntry : renderedTextStringComponent.mTextCharacterEntities)
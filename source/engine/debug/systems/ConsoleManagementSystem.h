@@ -26,7 +26,7 @@ namespace debug
 class ConsoleManagementSystem final : public ecs::BaseSystem<ecs::NullComponent>
 {
 public:
-    ConsoleManagementSystem();
+    ConsoleManagementSystem(ecs::World& world);
 
     void VUpdate(const float dt, const std::vector<ecs::EntityId>&) const override;
     void CreateConsoleBackgroundEntityIfNotAlive() const;
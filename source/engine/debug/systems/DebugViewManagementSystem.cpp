@@ -8,6 +8,7 @@
 #include "DebugViewManagementSystem.h"
 #include "../components/DebugViewStateSingletonComponent.h"
 #include "../../common/components/TransformComponent.h"
+#include "../../profiling/Profiler.h"
 #include "../../rendering/components/LightStoreSingletonComponent.h"
 #include "../../rendering/components/RenderableComponent.h"
 #include "../../rendering/utils/Colors.h"
@@ -44,10 +45,13 @@ namespace
 
 ///-----------------------------------------------------------------------------------------------
 
-DebugViewManagementSystem::DebugViewManagementSystem()
-    : BaseSystem()
+DebugViewManagementSystem::DebugViewManagementSystem(ecs::World& world)
+    : BaseSystem(world)
 {       
-    ecs::World::GetInstance().SetSingletonComponent<DebugViewStateSingletonComponent>(std::make_unique<DebugViewStateSingletonComponent>());        
+    // Frame statistics and debug visuals only need refreshing once per rendered frame
+    SetUpdatePhase(ecs::SystemUpdatePhase::PRESENTATION);
+    DeclareStructuralChanges();
+    GetWorld().SetSingletonComponent<DebugViewStateSingletonComponent>(std::make_unique<DebugViewStateSingletonComponent>());        
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -62,7 +66,7 @@ void DebugViewManagementSystem::VUpdate(const float, const std::vector<ecs::Enti
 
 void DebugViewManagementSystem::HandleFrameStatsDisplay() const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();    
     
     if (debugViewStateComponent.mFrameStatsDisplayEnabled)
@@ -71,6 +75,7 @@ void DebugViewManagementSystem::HandleFrameStatsDisplay() const
         if (debugViewStateComponent.mFpsStrings.second == ecs::NULL_ENTITY_ID ||
             !rendering::IsTextStringTheSameAsText
         (
+            GetWorld(),
             debugViewStateComponent.mFpsStrings.second, 
             std::to_string(debugViewStateComponent.mCurrentFps)
         ))
@@ -90,7 +95,7 @@ void DebugViewManagementSystem::HandleFrameStatsDisplay() const
 
 void DebugViewManagementSystem::HandleLightsDebug() const
 {
-    auto& world = ecs::World::GetInstance();
+    auto& world = GetWorld();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
     
     const auto& lightStoreComponent = world.GetSingletonComponent<rendering::LightStoreSingletonComponent>();
@@ -115,13 +120,13 @@ void DebugViewManagementSystem::HandleLightsDebug() const
 
 void DebugViewManagementSystem::ClearFrameStatsStrings() const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
 
     if (debugViewStateComponent.mFpsStrings.first != ecs::NULL_ENTITY_ID)
     {
-        rendering::DestroyRenderedText(debugViewStateComponent.mFpsStrings.first);
-        rendering::DestroyRenderedText(debugViewStateComponent.mFpsStrings.second);
+        rendering::DestroyRenderedText(GetWorld(), debugViewStateComponent.mFpsStrings.first);
+        rendering::DestroyRenderedText(GetWorld(), debugViewStateComponent.mFpsStrings.second);
 
         debugViewStateComponent.mFpsStrings.first  = ecs::NULL_ENTITY_ID;
         debugViewStateComponent.mFpsStrings.second = ecs::NULL_ENTITY_ID;
@@ -129,8 +134,8 @@ void DebugViewManagementSystem::ClearFrameStatsStrings() const
 
     if (debugViewStateComponent.mEntityCountStrings.first != ecs::NULL_ENTITY_ID)
     {
-        rendering::DestroyRenderedText(debugViewStateComponent.mEntityCountStrings.first);
-        rendering::DestroyRenderedText(debugViewStateComponent.mEntityCountStrings.second);
+        rendering::DestroyRenderedText(GetWorld(), debugViewStateComponent.mEntityCountStrings.first);
+        rendering::DestroyRenderedText(GetWorld(), debugViewStateComponent.mEntityCountStrings.second);
 
         debugViewStateComponent.mEntityCountStrings.first = ecs::NULL_ENTITY_ID;
         debugViewStateComponent.mEntityCountStrings.second = ecs::NULL_ENTITY_ID;
@@ -140,8 +145,8 @@ void DebugViewManagementSystem::ClearFrameStatsStrings() const
     {
         for (const auto& systemNameAndUpdateTimeStrings : debugViewStateComponent.mSystemNamesAndUpdateTimeStrings)
         {
-            rendering::DestroyRenderedText(systemNameAndUpdateTimeStrings.first);
-            rendering::DestroyRenderedText(systemNameAndUpdateTimeStrings.second);
+            rendering::DestroyRenderedText(GetWorld(), systemNameAndUpdateTimeStrings.first);
+            rendering::DestroyRenderedText(GetWorld(), systemNameAndUpdateTimeStrings.second);
         }
 
         debugViewStateComponent.mSystemNamesAndUpdateTimeStrings.clear();
@@ -152,7 +157,7 @@ void DebugViewManagementSystem::ClearFrameStatsStrings() const
 
 void DebugViewManagementSystem::ClearDebugLights() const
 {
-    auto& world = ecs::World::GetInstance();
+    auto& world = GetWorld();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
     
     world.DestroyEntities(debugViewStateComponent.mDebugLightEntities);
@@ -163,7 +168,7 @@ void DebugViewManagementSystem::ClearDebugLights() const
 
 void DebugViewManagementSystem::RenderFpsString() const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
 
     auto fpsTextColor = rendering::colors::BLACK;
@@ -178,6 +183,7 @@ void DebugViewManagementSystem::RenderFpsString() const
     
     debugViewStateComponent.mFpsStrings.first = rendering::RenderTextIfDifferentToPreviousString
     (
+        GetWorld(),
         "FPS: ",
         debugViewStateComponent.mFpsStrings.first,
         TEXT_FONT_NAME,
@@ -188,6 +194,7 @@ void DebugViewManagementSystem::RenderFpsString() const
     
     debugViewStateComponent.mFpsStrings.second = rendering::RenderTextIfDifferentToPreviousString
     (
+        GetWorld(),
         std::to_string(debugViewStateComponent.mCurrentFps),
         debugViewStateComponent.mFpsStrings.second,
         TEXT_FONT_NAME,
@@ -201,11 +208,12 @@ void DebugViewManagementSystem::RenderFpsString() const
 
 void DebugViewManagementSystem::RenderEntityCountString() const
 {
-    const auto& world = ecs::World::GetInstance();
+    const auto& world = GetWorld();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
 
     debugViewStateComponent.mEntityCountStrings.first = rendering::RenderTextIfDifferentToPreviousString
     (
+        GetWorld(),
         "Entities: ",
         debugViewStateComponent.mEntityCountStrings.first,
         TEXT_FONT_NAME,
@@ -216,6 +224,7 @@ void DebugViewManagementSystem::RenderEntityCountString() const
 
     debugViewStateComponent.mEntityCountStrings.second = rendering::RenderTextIfDifferentToPreviousString
     (
+        GetWorld(),
         std::to_string(world.GetEntityCount()),
         debugViewStateComponent.mEntityCountStrings.second,
         TEXT_FONT_NAME,
@@ -229,14 +238,14 @@ void DebugViewManagementSystem::RenderEntityCountString() const
 
 void DebugViewManagementSystem::RenderSystemUpdateStrings() const
 {
-    const auto& world = ecs::World::GetInstance();
-    const auto& systemUpdateTimes = world.GetSystemUpdateTimes();
+    const auto& world = GetWorld();
+    const auto& profiler = profiling::Profiler::GetInstance();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
 
     const auto isFirstRendering = debugViewStateComponent.mSystemNamesAndUpdateTimeStrings.size() == 0;
 
     auto systemCounter = 0;
-    for (const auto& systemNameUpdateTimePair: systemUpdateTimes)
+    for (const auto& systemName: world.GetSystemNames())
     {
         auto previousSystemNameString       = ecs::NULL_ENTITY_ID;
         auto previousSystemUpdateTimeString = ecs::NULL_ENTITY_ID;
@@ -252,7 +261,8 @@ void DebugViewManagementSystem::RenderSystemUpdateStrings() const
 
         auto systemNameString = rendering::RenderTextIfDifferentToPreviousString
         (
-            systemNameUpdateTimePair.first.GetString(),
+            GetWorld(),
+            systemName.GetString(),
             previousSystemNameString,
             TEXT_FONT_NAME,
             TEXT_SIZE,
@@ -263,9 +273,12 @@ void DebugViewManagementSystem::RenderSystemUpdateStrings() const
         auto systemUpdateTimePosition = SYSTEM_UPDATE_TIME_STARTING_POSITION;
         systemUpdateTimePosition.y -= systemCounter * TEXT_SIZE;
 
+        // Rolling percentiles rather than the last sample, so that spikes neither flicker by nor hide in the average
+        const auto systemUpdateStatistics = profiler.GetScopeStatistics(systemName);
         auto systemUpdateTimeString = rendering::RenderTextIfDifferentToPreviousString
         (
-            std::to_string(systemNameUpdateTimePair.second) + " micros",
+            GetWorld(),
+            "p50 " + std::to_string(static_cast<int>(systemUpdateStatistics.mP50Microseconds)) + " p99 " + std::to_string(static_cast<int>(systemUpdateStatistics.mP99Microseconds)) + " micros",
             previousSystemUpdateTimeString,
             TEXT_FONT_NAME,
             TEXT_SIZE,
@@ -290,7 +303,7 @@ void DebugViewManagementSystem::RenderSystemUpdateStrings() const
 
 void DebugViewManagementSystem::CreateDebugLights() const
 {
-    auto& world = ecs::World::GetInstance();
+    auto& world = GetWorld();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
     const auto& lightStoreComponent = world.GetSingletonComponent<rendering::LightStoreSingletonComponent>();
     
@@ -298,6 +311,7 @@ void DebugViewManagementSystem::CreateDebugLights() const
     {
         auto cubeEntity = rendering::LoadAndCreateModelByName
         (
+            GetWorld(),
             DEBUG_LIGHT_ASSET_NAME.GetString(),
             glm::vec3(0.0f, 0.0f, 0.0f),
             glm::vec3(0.0f, 0.0f, 0.0f),
@@ -319,7 +333,7 @@ void DebugViewManagementSystem::CreateDebugLights() const
 
 void DebugViewManagementSystem::UpdateDebugLightsPosition() const
 {
-    auto& world = ecs::World::GetInstance();
+    auto& world = GetWorld();
     auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
     const auto& lightStoreComponent = world.GetSingletonComponent<rendering::LightStoreSingletonComponent>();
     
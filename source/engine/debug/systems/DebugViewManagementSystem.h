@@ -26,7 +26,7 @@ namespace debug
 class DebugViewManagementSystem final : public ecs::BaseSystem<ecs::NullComponent>
 {
 public:
-    DebugViewManagementSystem();
+    DebugViewManagementSystem(ecs::World& world);
 
     void VUpdate(const float dt, const std::vector<ecs::EntityId>&) const override;
 
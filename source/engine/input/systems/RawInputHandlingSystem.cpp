@@ -20,13 +20,17 @@ namespace input
 
 ///-----------------------------------------------------------------------------------------------
 
-RawInputHandlingSystem::RawInputHandlingSystem()
-    : BaseSystem()
+RawInputHandlingSystem::RawInputHandlingSystem(ecs::World& world)
+    : BaseSystem(world)
 {
+    // SDL's keyboard state can only be polled from the main thread
+    PinToMainThread();
+    DeclareWriteAccess<InputStateSingletonComponent>();
+    
     auto inputStateComponent = std::make_unique<InputStateSingletonComponent>();
     inputStateComponent->mPreviousRawKeyboardState.resize(DEFAULT_KEY_COUNT, 0);
 
-    ecs::World::GetInstance().SetSingletonComponent<InputStateSingletonComponent>(std::move(inputStateComponent));
+    GetWorld().SetSingletonComponent<InputStateSingletonComponent>(std::move(inputStateComponent));
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -35,7 +39,7 @@ void RawInputHandlingSystem::VUpdate(const float, const std::vector<ecs::EntityI
 {   
     auto keyboardStateLength         = 0;
     const auto* currentKeyboardState = SDL_GetKeyboardState(&keyboardStateLength);
-    auto& inputStateComponent        = ecs::World::GetInstance().GetSingletonComponent<InputStateSingletonComponent>();
+    auto& inputStateComponent        = GetWorld().GetSingletonComponent<InputStateSingletonComponent>();
 
     for (const auto& keybindingEntry: inputStateComponent.mKeybindings)
     {
@@ -26,7 +26,7 @@ namespace input
 class RawInputHandlingSystem final : public ecs::BaseSystem<ecs::NullComponent>
 {
 public:
-    RawInputHandlingSystem();
+    RawInputHandlingSystem(ecs::World& world);
 
     void VUpdate(const float dt, const std::vector<ecs::EntityId>&) const override;
 };
@@ -0,0 +1,242 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystem.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "JobSystem.h"
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace jobs
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const std::size_t NON_WORKER_THREAD_INDEX = static_cast<std::size_t>(-1);
+
+    // Index of the job deque owned by the current thread, if it is a worker thread
+    thread_local std::size_t sCurrentWorkerIndex = NON_WORKER_THREAD_INDEX;
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem& JobSystem::GetInstance()
+{
+    static JobSystem instance;
+    return instance;
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::JobSystem()
+    : mQueuedJobCount(0U)
+    , mNextExternalQueueIndex(0U)
+    , mIsShuttingDown(false)
+{
+    // The thread that waits on jobs helps executing them, so one hardware thread is left for it
+    const auto hardwareThreadCount = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    StartWorkerThreads(hardwareThreadCount > 1U ? hardwareThreadCount - 1U : 0U);
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::~JobSystem()
+{
+    StopWorkerThreads();
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::size_t JobSystem::GetWorkerThreadCount() const
+{
+    return mWorkerThreads.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::SetWorkerThreadCount(const std::size_t workerThreadCount)
+{
+    assert(mQueuedJobCount.load() == 0U &&
+        "Worker threads can not be replaced while jobs are in flight");
+
+    StopWorkerThreads();
+    StartWorkerThreads(workerThreadCount);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::ScheduleJob(Job job, JobCounter& counter)
+{
+    counter.mPendingJobCount.fetch_add(1U, std::memory_order_relaxed);
+
+    const auto queueIndex = sCurrentWorkerIndex < mWorkerQueues.size() ?
+        sCurrentWorkerIndex :
+        mNextExternalQueueIndex.fetch_add(1U, std::memory_order_relaxed) % mWorkerQueues.size();
+
+    auto& workerQueue = *mWorkerQueues[queueIndex];
+    {
+        std::lock_guard<std::mutex> lock(workerQueue.mMutex);
+        workerQueue.mJobs.push_back(PendingJob{ std::move(job), &counter });
+    }
+
+    // The wake up mutex is acquired so that the notification can not slip in between
+    // a worker checking for queued jobs and starting to wait
+    mQueuedJobCount.fetch_add(1U, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(mWakeUpMutex);
+    }
+    mWakeUpCondition.notify_one();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::WaitForCounter(const JobCounter& counter)
+{
+    while (!counter.IsComplete())
+    {
+        PendingJob pendingJob;
+        if (TryPopJob(pendingJob))
+        {
+            ExecuteJob(pendingJob);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::StartWorkerThreads(const std::size_t workerThreadCount)
+{
+    mIsShuttingDown = false;
+
+    // A deque is always available, so that jobs can be scheduled with no worker threads too
+    mWorkerQueues.clear();
+    for (auto i = 0U; i < std::max(workerThreadCount, static_cast<std::size_t>(1U)); ++i)
+    {
+        mWorkerQueues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (auto i = 0U; i < workerThreadCount; ++i)
+    {
+        mWorkerThreads.emplace_back([this, i]() { WorkerThreadLoop(i); });
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::StopWorkerThreads()
+{
+    {
+        std::lock_guard<std::mutex> lock(mWakeUpMutex);
+        mIsShuttingDown = true;
+    }
+
+    mWakeUpCondition.notify_all();
+
+    for (auto& workerThread: mWorkerThreads)
+    {
+        workerThread.join();
+    }
+
+    mWorkerThreads.clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::WorkerThreadLoop(const std::size_t workerIndex)
+{
+    sCurrentWorkerIndex = workerIndex;
+
+    while (true)
+    {
+        PendingJob pendingJob;
+        if (TryPopJob(pendingJob))
+        {
+            ExecuteJob(pendingJob);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mWakeUpMutex);
+        mWakeUpCondition.wait(lock, [this]() { return mIsShuttingDown || mQueuedJobCount.load(std::memory_order_acquire) != 0U; });
+
+        if (mIsShuttingDown && mQueuedJobCount.load(std::memory_order_acquire) == 0U)
+        {
+            return;
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool JobSystem::TryPopJob(PendingJob& pendingJob)
+{
+    const auto queueCount = mWorkerQueues.size();
+    const auto isWorkerThread = sCurrentWorkerIndex < queueCount;
+
+    // Workers first pop the most recently scheduled job of their own deque
+    if (isWorkerThread)
+    {
+        auto& ownQueue = *mWorkerQueues[sCurrentWorkerIndex];
+        std::lock_guard<std::mutex> lock(ownQueue.mMutex);
+
+        if (!ownQueue.mJobs.empty())
+        {
+            pendingJob = std::move(ownQueue.mJobs.back());
+            ownQueue.mJobs.pop_back();
+            mQueuedJobCount.fetch_sub(1U, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Then steal the oldest job of any other deque
+    const auto firstVictimIndex = isWorkerThread ? sCurrentWorkerIndex + 1U : 0U;
+    for (auto i = 0U; i < queueCount; ++i)
+    {
+        const auto victimIndex = (firstVictimIndex + i) % queueCount;
+        if (isWorkerThread && victimIndex == sCurrentWorkerIndex)
+        {
+            continue;
+        }
+
+        auto& victimQueue = *mWorkerQueues[victimIndex];
+        std::lock_guard<std::mutex> lock(victimQueue.mMutex);
+
+        if (!victimQueue.mJobs.empty())
+        {
+            pendingJob = std::move(victimQueue.mJobs.front());
+            victimQueue.mJobs.pop_front();
+            mQueuedJobCount.fetch_sub(1U, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::ExecuteJob(PendingJob& pendingJob)
+{
+    pendingJob.mJob();
+    pendingJob.mCounter->mPendingJobCount.fetch_sub(1U, std::memory_order_release);
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
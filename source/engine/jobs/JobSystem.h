@@ -0,0 +1,202 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystem.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef JobSystem_h
+#define JobSystem_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace jobs
+{
+
+///------------------------------------------------------------------------------------------------
+
+using Job = std::function<void()>;
+
+///------------------------------------------------------------------------------------------------
+/// Tracks the number of scheduled jobs of a group that have not finished executing yet.
+class JobCounter final
+{
+    friend class JobSystem;
+
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    const JobCounter& operator = (const JobCounter&) = delete;
+
+    /// @returns whether all jobs tracked by this counter have finished executing.
+    inline bool IsComplete() const
+    {
+        return mPendingJobCount.load(std::memory_order_acquire) == 0U;
+    }
+
+private:
+    std::atomic<std::size_t> mPendingJobCount{0U};
+};
+
+///------------------------------------------------------------------------------------------------
+/// A pool of worker threads executing jobs submitted from any thread.
+///
+/// Each worker owns a job deque. Jobs scheduled from a worker go to the back of its own deque and
+/// are popped back in LIFO order (for cache locality), while jobs scheduled from other threads are
+/// distributed across all deques. Idle workers, as well as threads waiting on a counter, steal jobs
+/// from the front of the other deques.
+class JobSystem final
+{
+public:
+    /// The default method of getting a hold of this singleton.
+    ///
+    /// The single instance of this class will be lazily initialized
+    /// the first time it is needed.
+    /// @returns a reference to the single instance of this class.
+    static JobSystem& GetInstance();
+
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    const JobSystem& operator = (const JobSystem&) = delete;
+    JobSystem& operator = (JobSystem&&) = delete;
+
+    /// @returns the number of worker threads (not including the threads waiting on jobs).
+    std::size_t GetWorkerThreadCount() const;
+
+    /// Replaces the worker threads with the given number of new ones. Must not be called while jobs are in flight.
+    /// @param[in] workerThreadCount the number of worker threads to create. With 0, all jobs execute on the waiting threads.
+    void SetWorkerThreadCount(const std::size_t workerThreadCount);
+
+    /// Schedules the given job for execution on any of the worker threads.
+    /// @param[in] job the job to execute.
+    /// @param[in] counter the counter tracking the job's completion. Needs to outlive the job's execution.
+    void ScheduleJob(Job job, JobCounter& counter);
+
+    /// Blocks until all jobs tracked by the given counter have finished executing.
+    ///
+    /// The calling thread executes pending jobs while waiting, so jobs complete even when no
+    /// worker threads are available, and waiting from within a job does not deadlock.
+    /// @param[in] counter the counter to wait on.
+    void WaitForCounter(const JobCounter& counter);
+
+private:
+    struct PendingJob
+    {
+        Job mJob;
+        JobCounter* mCounter = nullptr;
+    };
+
+    struct WorkerQueue
+    {
+        std::deque<PendingJob> mJobs;
+        std::mutex mMutex;
+    };
+
+    JobSystem();
+
+    /// Spawns the given number of worker threads, along with their job deques.
+    /// @param[in] workerThreadCount the number of worker threads to spawn.
+    void StartWorkerThreads(const std::size_t workerThreadCount);
+
+    /// Signals all worker threads to finish their pending jobs and joins them.
+    void StopWorkerThreads();
+
+    /// Main loop of each worker thread.
+    /// @param[in] workerIndex the index of the worker's own job deque.
+    void WorkerThreadLoop(const std::size_t workerIndex);
+
+    /// Pops a job from the calling worker's own deque, or steals one from the other deques.
+    /// @param[out] pendingJob the job popped, if any.
+    /// @returns whether a job was popped.
+    bool TryPopJob(PendingJob& pendingJob);
+
+    /// Executes the given job and signals its counter.
+    /// @param[in] pendingJob the job to execute.
+    void ExecuteJob(PendingJob& pendingJob);
+
+private:
+    std::vector<std::thread> mWorkerThreads;
+    std::vector<std::unique_ptr<WorkerQueue>> mWorkerQueues;
+    std::atomic<std::size_t> mQueuedJobCount;
+    std::atomic<std::size_t> mNextExternalQueueIndex;
+    std::mutex mWakeUpMutex;
+    std::condition_variable mWakeUpCondition;
+    bool mIsShuttingDown;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Invokes the given function for every element of the given random access container, splitting the
+/// work in jobs of (at most) chunkSize elements. The calling thread processes the first chunk and then
+/// helps with the rest, returning once all elements have been processed.
+///
+/// The function is invoked concurrently from multiple threads, so it must only mutate data
+/// that is private to each element. Elements of non-const containers are passed by mutable reference.
+/// @param[in] elements the elements to process (e.g. a system's entitiesToProcess).
+/// @param[in] chunkSize the number of elements processed by each job.
+/// @param[in] function the function to invoke with each element.
+template<class ContainerType, class Function>
+inline void ParallelFor(ContainerType& elements, const std::size_t chunkSize, Function&& function)
+{
+    assert(chunkSize > 0U && "ParallelFor chunk size must be positive");
+
+    auto& jobSystem = JobSystem::GetInstance();
+    if (elements.size() <= chunkSize || jobSystem.GetWorkerThreadCount() == 0U)
+    {
+        for (auto& element: elements)
+        {
+            function(element);
+        }
+
+        return;
+    }
+
+    JobCounter counter;
+    for (std::size_t chunkStart = chunkSize; chunkStart < elements.size(); chunkStart += chunkSize)
+    {
+        jobSystem.ScheduleJob([&elements, &function, chunkStart, chunkSize]()
+        {
+            const auto chunkEnd = std::min(chunkStart + chunkSize, static_cast<std::size_t>(elements.size()));
+            for (auto i = chunkStart; i < chunkEnd; ++i)
+            {
+                function(elements[i]);
+            }
+        }, counter);
+    }
+
+    for (std::size_t i = 0U; i < chunkSize; ++i)
+    {
+        function(elements[i]);
+    }
+
+    jobSystem.WaitForCounter(counter);
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* JobSystem_h */
@@ -0,0 +1,212 @@
+///------------------------------------------------------------------------------------------------
+///  Profiler.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "Profiler.h"
+#include "../common/utils/Logging.h"
+
+#include <algorithm>
+#include <cstdio>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace profiling
+{
+
+///------------------------------------------------------------------------------------------------
+
+static float CalculatePercentileMicroseconds(std::vector<std::uint64_t>& durationNanoseconds, const float percentile)
+{
+    const auto percentileIndex = std::min(durationNanoseconds.size() - 1U, static_cast<std::size_t>(percentile * durationNanoseconds.size()));
+    std::nth_element(durationNanoseconds.begin(), durationNanoseconds.begin() + percentileIndex, durationNanoseconds.end());
+    return durationNanoseconds[percentileIndex]/1000.0f;
+}
+
+///------------------------------------------------------------------------------------------------
+
+ProfileEventBuffer::ProfileEventBuffer(const std::uint32_t threadIndex)
+    : mEvents(new ProfileEvent[PROFILE_EVENT_BUFFER_CAPACITY])
+    , mThreadIndex(threadIndex)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::size_t ProfileEventBuffer::Drain(std::vector<ProfileEvent>& events)
+{
+    const auto readIndex  = mReadIndex.load(std::memory_order_relaxed);
+    const auto writeIndex = mWriteIndex.load(std::memory_order_acquire);
+
+    for (auto eventIndex = readIndex; eventIndex < writeIndex; ++eventIndex)
+    {
+        events.push_back(mEvents[eventIndex % PROFILE_EVENT_BUFFER_CAPACITY]);
+    }
+
+    // Hands the drained slots back to the producer
+    mReadIndex.store(writeIndex, std::memory_order_release);
+    return mDroppedEventCount.exchange(0U, std::memory_order_relaxed);
+}
+
+///------------------------------------------------------------------------------------------------
+
+Profiler& Profiler::GetInstance()
+{
+    // Deliberately never destroyed, since threads may still record timings (or release their
+    // buffers) while the other static objects are being destroyed on exit
+    static auto* instance = new Profiler;
+    return *instance;
+}
+
+///------------------------------------------------------------------------------------------------
+
+Profiler::Profiler()
+    : mEpoch(std::chrono::steady_clock::now())
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+const char* Profiler::InternScopeName(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mEventBuffersMutex);
+    return mInternedScopeNames.insert(name).first->c_str();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::CollectEvents()
+{
+    mCollectedEvents.clear();
+    {
+        std::lock_guard<std::mutex> lock(mEventBuffersMutex);
+        for (auto& eventBuffer: mEventBuffers)
+        {
+            mDroppedEventCount += eventBuffer->Drain(mCollectedEvents);
+        }
+    }
+
+    for (const auto& event: mCollectedEvents)
+    {
+        auto& scopeHistory = mScopeHistories[StringId(event.mName)];
+        const auto durationNanoseconds = event.mEndNanoseconds - event.mStartNanoseconds;
+
+        if (scopeHistory.mDurationNanoseconds.size() < PROFILE_SCOPE_HISTORY_SIZE)
+        {
+            scopeHistory.mDurationNanoseconds.push_back(durationNanoseconds);
+        }
+        else
+        {
+            scopeHistory.mDurationNanoseconds[scopeHistory.mNextSampleIndex] = durationNanoseconds;
+        }
+
+        scopeHistory.mNextSampleIndex = (scopeHistory.mNextSampleIndex + 1U) % PROFILE_SCOPE_HISTORY_SIZE;
+    }
+
+    if (mIsCapturing)
+    {
+        const auto capturedEventCount = std::min(mCollectedEvents.size(), MAX_CAPTURED_PROFILE_EVENTS - mCapturedEvents.size());
+        mCapturedEvents.insert(mCapturedEvents.end(), mCollectedEvents.begin(), mCollectedEvents.begin() + capturedEventCount);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+ProfileScopeStatistics Profiler::GetScopeStatistics(const StringId& scopeName) const
+{
+    ProfileScopeStatistics scopeStatistics;
+
+    auto scopeHistoryIter = mScopeHistories.find(scopeName);
+    if (scopeHistoryIter == mScopeHistories.end() || scopeHistoryIter->second.mDurationNanoseconds.empty())
+    {
+        return scopeStatistics;
+    }
+
+    // Selecting the percentiles reorders the samples, so it operates on a copy of them
+    auto durationNanoseconds = scopeHistoryIter->second.mDurationNanoseconds;
+    scopeStatistics.mSampleCount     = durationNanoseconds.size();
+    scopeStatistics.mP50Microseconds = CalculatePercentileMicroseconds(durationNanoseconds, 0.5f);
+    scopeStatistics.mP99Microseconds = CalculatePercentileMicroseconds(durationNanoseconds, 0.99f);
+    return scopeStatistics;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::StartCapture()
+{
+    mCapturedEvents.clear();
+    mDroppedEventCount = 0U;
+    mIsCapturing = true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool Profiler::StopCaptureAndExportChromeTrace(const std::string& filePath)
+{
+    mIsCapturing = false;
+
+    auto* traceFile = std::fopen(filePath.c_str(), "w");
+    if (traceFile == nullptr)
+    {
+        Log(LogType::ERROR, "Could not open %s to export the profiler capture", filePath.c_str());
+        return false;
+    }
+
+    // Complete ("X") events, with timestamps and durations in microseconds. Nesting is inferred by the viewers
+    std::fprintf(traceFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (auto i = 0U; i < mCapturedEvents.size(); ++i)
+    {
+        const auto& event = mCapturedEvents[i];
+        std::fprintf
+        (
+            traceFile,
+            "{\"name\":\"%s\",\"cat\":\"genesis\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+            event.mName,
+            event.mThreadIndex,
+            event.mStartNanoseconds/1000.0,
+            (event.mEndNanoseconds - event.mStartNanoseconds)/1000.0,
+            i + 1U < mCapturedEvents.size() ? "," : ""
+        );
+    }
+    std::fprintf(traceFile, "]}\n");
+    std::fclose(traceFile);
+
+    Log(LogType::INFO, "Exported %zu profiler events to %s (%zu dropped)", mCapturedEvents.size(), filePath.c_str(), mDroppedEventCount);
+    mCapturedEvents.clear();
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+ProfileEventBuffer& Profiler::ClaimEventBuffer()
+{
+    std::lock_guard<std::mutex> lock(mEventBuffersMutex);
+
+    // Buffers of exited threads are reused, so that recreating worker threads does not keep allocating new ones
+    for (auto& eventBuffer: mEventBuffers)
+    {
+        auto isOwned = false;
+        if (eventBuffer->mIsOwned.compare_exchange_strong(isOwned, true, std::memory_order_acq_rel))
+        {
+            return *eventBuffer;
+        }
+    }
+
+    mEventBuffers.push_back(std::make_unique<ProfileEventBuffer>(static_cast<std::uint32_t>(mEventBuffers.size())));
+    return *mEventBuffers.back();
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
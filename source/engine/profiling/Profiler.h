@@ -0,0 +1,281 @@
+///------------------------------------------------------------------------------------------------
+///  Profiler.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef Profiler_h
+#define Profiler_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../common/utils/StringUtils.h"
+
+#include <tsl/robin_map.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+// Uncomment to compile all profile scopes out
+//#define GENESIS_PROFILING_DISABLED
+
+///------------------------------------------------------------------------------------------------
+
+#define GENESIS_PROFILE_CONCATENATE_INNER(first, second) first##second
+#define GENESIS_PROFILE_CONCATENATE(first, second) GENESIS_PROFILE_CONCATENATE_INNER(first, second)
+
+///------------------------------------------------------------------------------------------------
+/// Times the rest of the enclosing scope under the given name. Scopes nest, i.e. a scope opened
+/// while another one is open on the same thread shows up as its child in the exported trace.
+/// The name needs to outlive the profiler (a string literal or a name returned by InternScopeName).
+#if defined(GENESIS_PROFILING_DISABLED)
+#define GENESIS_PROFILE_SCOPE(name)
+#else
+#define GENESIS_PROFILE_SCOPE(name) const ::genesis::profiling::ProfileScope GENESIS_PROFILE_CONCATENATE(profileScope, __LINE__)(name)
+#endif
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace profiling
+{
+
+///------------------------------------------------------------------------------------------------
+
+/// The number of scope timings each thread can have recorded before they are collected. Timings
+/// recorded while a thread's buffer is full are dropped.
+static constexpr std::size_t PROFILE_EVENT_BUFFER_CAPACITY = 8192U;
+
+/// The number of most recent timings of each scope that its percentiles are calculated over.
+static constexpr std::size_t PROFILE_SCOPE_HISTORY_SIZE = 240U;
+
+/// The maximum number of timings a single capture can hold, after which the capture stops growing.
+static constexpr std::size_t MAX_CAPTURED_PROFILE_EVENTS = 1U << 20;
+
+///------------------------------------------------------------------------------------------------
+/// A single timing of a profile scope.
+struct ProfileEvent
+{
+    const char* mName             = nullptr;
+    std::uint64_t mStartNanoseconds = 0U;
+    std::uint64_t mEndNanoseconds   = 0U;
+    std::uint32_t mThreadIndex      = 0U;
+};
+
+///------------------------------------------------------------------------------------------------
+/// The rolling statistics of a profile scope, over its PROFILE_SCOPE_HISTORY_SIZE most recent timings.
+struct ProfileScopeStatistics
+{
+    float mP50Microseconds   = 0.0f;
+    float mP99Microseconds   = 0.0f;
+    std::size_t mSampleCount = 0U;
+};
+
+///------------------------------------------------------------------------------------------------
+/// A single producer/single consumer ring of the timings recorded by one thread.
+///
+/// The owning thread pushes without taking any locks, while the profiler drains it when collecting.
+class ProfileEventBuffer final
+{
+public:
+    explicit ProfileEventBuffer(const std::uint32_t threadIndex);
+
+    ProfileEventBuffer(const ProfileEventBuffer&) = delete;
+    const ProfileEventBuffer& operator = (const ProfileEventBuffer&) = delete;
+
+    /// @returns the index identifying the owning thread in exported traces.
+    inline std::uint32_t GetThreadIndex() const
+    {
+        return mThreadIndex;
+    }
+
+    /// Records a timing. Must only be called by the owning thread.
+    /// @param[in] name the name of the timed scope.
+    /// @param[in] startNanoseconds the start of the timing \see Profiler::GetTimestamp()
+    /// @param[in] endNanoseconds the end of the timing \see Profiler::GetTimestamp()
+    inline void Push(const char* name, const std::uint64_t startNanoseconds, const std::uint64_t endNanoseconds)
+    {
+        const auto writeIndex = mWriteIndex.load(std::memory_order_relaxed);
+        if (writeIndex - mReadIndex.load(std::memory_order_acquire) >= PROFILE_EVENT_BUFFER_CAPACITY)
+        {
+            mDroppedEventCount.fetch_add(1U, std::memory_order_relaxed);
+            return;
+        }
+
+        auto& event = mEvents[writeIndex % PROFILE_EVENT_BUFFER_CAPACITY];
+        event.mName             = name;
+        event.mStartNanoseconds = startNanoseconds;
+        event.mEndNanoseconds   = endNanoseconds;
+        event.mThreadIndex      = mThreadIndex;
+
+        // Publishes the event to the consumer
+        mWriteIndex.store(writeIndex + 1U, std::memory_order_release);
+    }
+
+    /// Moves all timings recorded so far out of the buffer. Must only be called by a single consumer at a time.
+    /// @param[out] events the list to append the drained timings to.
+    /// @returns the number of timings dropped since the last drain, due to the buffer being full.
+    std::size_t Drain(std::vector<ProfileEvent>& events);
+
+    /// Whether the owning thread is still alive. Buffers of exited threads are reused by new ones.
+    std::atomic<bool> mIsOwned{true};
+
+private:
+    std::unique_ptr<ProfileEvent[]> mEvents;
+    std::atomic<std::uint64_t> mWriteIndex{0U};
+    std::atomic<std::uint64_t> mReadIndex{0U};
+    std::atomic<std::size_t> mDroppedEventCount{0U};
+    const std::uint32_t mThreadIndex;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Collects the timings of all profile scopes across threads, and turns them into rolling per scope
+/// statistics and (optionally) captures exportable as Chrome trace/Perfetto JSON.
+///
+/// Recording is lock free and thread safe. All other methods need to be called from the main thread.
+class Profiler final
+{
+public:
+    /// The default method of getting a hold of this singleton.
+    ///
+    /// The single instance of this class will be lazily initialized
+    /// the first time it is needed.
+    /// @returns a reference to the single instance of this class.
+    static Profiler& GetInstance();
+
+    ~Profiler() = default;
+    Profiler(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    const Profiler& operator = (const Profiler&) = delete;
+    Profiler& operator = (Profiler&&) = delete;
+
+    /// @returns the nanoseconds elapsed since the profiler's creation.
+    inline std::uint64_t GetTimestamp() const
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mEpoch).count());
+    }
+
+    /// @returns the calling thread's timing buffer, claiming one the first time a thread records a timing.
+    inline ProfileEventBuffer& GetThreadEventBuffer()
+    {
+        thread_local ThreadEventBufferOwnership sThreadEventBufferOwnership;
+        if (sThreadEventBufferOwnership.mEventBuffer == nullptr)
+        {
+            sThreadEventBufferOwnership.mEventBuffer = &ClaimEventBuffer();
+        }
+
+        return *sThreadEventBufferOwnership.mEventBuffer;
+    }
+
+    /// Stores a copy of the given scope name, for names that are not known at compile time.
+    /// @param[in] name the name to store.
+    /// @returns a pointer to the stored name, which remains valid for the lifetime of the profiler.
+    const char* InternScopeName(const std::string& name);
+
+    /// Moves the timings recorded by all threads into the scope statistics (and the capture, if one is running).
+    /// Should be called once per frame.
+    void CollectEvents();
+
+    /// @param[in] scopeName the name of the scope to get the statistics for.
+    /// @returns the rolling statistics of the scope with the given name (empty if it has not been timed yet).
+    ProfileScopeStatistics GetScopeStatistics(const StringId& scopeName) const;
+
+    /// @returns whether a capture is currently running.
+    inline bool IsCapturing() const
+    {
+        return mIsCapturing;
+    }
+
+    /// Starts capturing all timings collected from this point on, discarding those of any previous capture.
+    void StartCapture();
+
+    /// Stops the running capture and writes it out in the Chrome trace event format, which can be
+    /// opened in chrome://tracing or ui.perfetto.dev.
+    /// @param[in] filePath the path of the JSON file to write.
+    /// @returns whether the file could be written.
+    bool StopCaptureAndExportChromeTrace(const std::string& filePath);
+
+private:
+    struct ThreadEventBufferOwnership
+    {
+        ~ThreadEventBufferOwnership()
+        {
+            if (mEventBuffer != nullptr)
+            {
+                mEventBuffer->mIsOwned.store(false, std::memory_order_release);
+            }
+        }
+
+        ProfileEventBuffer* mEventBuffer = nullptr;
+    };
+
+    struct ScopeHistory
+    {
+        std::vector<std::uint64_t> mDurationNanoseconds;
+        std::size_t mNextSampleIndex = 0U;
+    };
+
+    Profiler();
+
+    ProfileEventBuffer& ClaimEventBuffer();
+
+    const std::chrono::steady_clock::time_point mEpoch;
+
+    std::mutex mEventBuffersMutex;
+    std::vector<std::unique_ptr<ProfileEventBuffer>> mEventBuffers;
+    std::unordered_set<std::string> mInternedScopeNames;
+
+    tsl::robin_map<StringId, ScopeHistory, StringIdHasher> mScopeHistories;
+    std::vector<ProfileEvent> mCollectedEvents;
+    std::vector<ProfileEvent> mCapturedEvents;
+    std::size_t mDroppedEventCount = 0U;
+    bool mIsCapturing = false;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Times its own lifetime and records it in the calling thread's timing buffer \see GENESIS_PROFILE_SCOPE
+class ProfileScope final
+{
+public:
+    explicit ProfileScope(const char* name)
+        : mName(name)
+        , mStartNanoseconds(Profiler::GetInstance().GetTimestamp())
+    {
+    }
+
+    ~ProfileScope()
+    {
+        auto& profiler = Profiler::GetInstance();
+        profiler.GetThreadEventBuffer().Push(mName, mStartNanoseconds, profiler.GetTimestamp());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    const ProfileScope& operator = (const ProfileScope&) = delete;
+
+private:
+    const char* mName;
+    const std::uint64_t mStartNanoseconds;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* Profiler_h */
@@ -63,6 +63,12 @@ public:
     float mZFar                 = DEFAULT_CAMERA_Z_FAR;
     float mPitch                = DEFAULT_CAMERA_PITCH;
     float mYaw                  = DEFAULT_CAMERA_YAW;
+    
+    // The camera as of the previous simulation tick, which rendering interpolates from,
+    // and the interpolated position the current frame is rendered from
+    glm::vec3 mPreviousPosition    = DEFAULT_CAMERA_POSITION;
+    glm::vec3 mPreviousFrontVector = DEFAULT_CAMERA_FRONT_VECTOR;
+    glm::vec3 mEyePosition         = DEFAULT_CAMERA_POSITION;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -13,9 +13,9 @@
 #include "../../ECS.h"
 #include "../../common/utils/MathUtils.h"
 #include "../../common/utils/StringUtils.h"
+#include "../utils/ShaderParameterBlock.h"
 
-#include <tsl/robin_map.h>
-#include <vector>
+#include <memory>
 
 ///-----------------------------------------------------------------------------------------------
 
@@ -33,19 +33,6 @@ using ResourceId = unsigned int;
 
 ///-----------------------------------------------------------------------------------------------
 
-struct ShaderUniforms final
-{
-    tsl::robin_map<StringId, std::vector<glm::vec4>, StringIdHasher> mShaderFloatVec4ArrayUniforms;
-    tsl::robin_map<StringId, std::vector<glm::vec3>, StringIdHasher> mShaderFloatVec3ArrayUniforms;
-    tsl::robin_map<StringId, glm::mat4, StringIdHasher> mShaderMatrixUniforms;
-    tsl::robin_map<StringId, glm::vec4, StringIdHasher> mShaderFloatVec4Uniforms;
-    tsl::robin_map<StringId, glm::vec3, StringIdHasher> mShaderFloatVec3Uniforms;
-    tsl::robin_map<StringId, float, StringIdHasher> mShaderFloatUniforms;
-    tsl::robin_map<StringId, int, StringIdHasher> mShaderIntUniforms;
-};
-
-///-----------------------------------------------------------------------------------------------
-
 struct MaterialProperties final
 {
     glm::vec4 mAmbient;
@@ -59,13 +46,14 @@ struct MaterialProperties final
 class RenderableComponent final: public ecs::IComponent
 {
 public:    
-    ShaderUniforms mShaderUniforms;
+    std::shared_ptr<ShaderParameterBlock> mShaderParameters; // Shared by all entities using the same material, may be null
     MaterialProperties mMaterial;
     ResourceId mMeshResourceId    = 0;
     ResourceId mTextureResourceId = 0;            
     StringId mShaderNameId        = StringId();
     bool mIsVisible               = true;
     bool mIsGuiComponent          = false;
+    bool mIsTransparent           = false;
     bool mIsAffectedByLight       = false;
 };
 
@@ -17,6 +17,11 @@
 #include "../../resources/ResourceLoadingService.h"
 #include "../../resources/ShaderResource.h"
 #include "../../resources/TextureResource.h"
+#include "../utils/RenderQueueUtils.h"
+#include "../utils/ShaderParameterBlock.h"
+#include "../utils/UniformBlockUtils.h"
+
+#include <vector>
 
 ///-----------------------------------------------------------------------------------------------
 
@@ -42,16 +47,46 @@ public:
     SDL_GLContext mGLContext            = nullptr;
     GLuint mDefaultVertexArrayObject    = 0;        
     glm::vec4 mClearColor               = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
+    
+    // Uniform buffers, along with the material last uploaded so that unchanged materials are not uploaded again
+    GLuint mFrameUniformBufferObject                   = 0;
+    GLuint mMaterialUniformBufferObject                = 0;
+    MaterialUniformBlock mUploadedMaterialUniformBlock = {};
+    bool mHasUploadedMaterial                          = false;
+    
+    // Instanced draw call state, the instance data being reused across batches to avoid allocations
+    GLuint mInstanceBufferObject        = 0;
+    std::vector<InstanceData> mInstanceData;
+
+    // How far the frame lies between the previous and the latest simulation tick, in [0, 1]
+    float mSimulationInterpolationFactor = 1.0f;
+
+    // The number of draw calls, instances drawn through instanced draw calls, GL state binds and material uploads issued in the last rendered frame
+    int mDrawCallCount       = 0;
+    int mInstanceCount       = 0;
+    int mShaderBindCount     = 0;
+    int mTextureBindCount    = 0;
+    int mMeshBindCount       = 0;
+    int mMaterialUploadCount = 0;
 
     // Previous render call resource pointers
     const resources::ShaderResource* previousShader   = nullptr;
     const resources::TextureResource* previousTexture = nullptr;
     const resources::MeshResource* previousMesh       =  nullptr;
 
+    // Uniform handles of the previous render call's shader, resolved once per shader bind
+    resources::UniformHandle<glm::mat4> previousShaderWorldMatrixUniform;
+    resources::UniformHandle<glm::mat4> previousShaderNormalMatrixUniform;
+
+    // The shader parameter block last applied, along with its version and the shader it was applied to
+    const ShaderParameterBlock* previousShaderParameters = nullptr;
+    std::uint32_t previousShaderParametersVersion        = 0U;
+    StringId previousShaderParametersShaderNameId        = StringId();
+
     // Previous render call resource ids
     StringId previousShaderNameId             = StringId();
-    resources::ResourceId previousTextureResourceId = ResourceId();
-    resources::ResourceId previousMeshResourceId    = ResourceId();
+    resources::ResourceId previousTextureResourceId = resources::ResourceId();
+    resources::ResourceId previousMeshResourceId    = resources::ResourceId();
     
 };
 
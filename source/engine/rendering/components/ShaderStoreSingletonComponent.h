@@ -32,6 +32,9 @@ class ShaderStoreSingletonComponent final: public ecs::IComponent
 {
 public:
     tsl::robin_map<StringId, resources::ShaderResource, StringIdHasher> mShaders;
+    
+    // Maps shader names to the names of their instanced variants, for the shaders that have one
+    tsl::robin_map<StringId, StringId, StringIdHasher> mInstancedShaderVariantNames;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -12,6 +12,14 @@
 #include "gl2ext.h"
 #include <assert.h>
 
+// Desktop GL 3.x enums absent from the GLES2 headers
+#ifndef GL_UNIFORM_BUFFER
+#define GL_UNIFORM_BUFFER 0x8A11
+#endif
+#ifndef GL_INVALID_INDEX
+#define GL_INVALID_INDEX 0xFFFFFFFFu
+#endif
+
 struct GLFuncTable {
 #define GL_FUNC(retVal, name, args) retVal (GL_APIENTRY *name)args;
 #include "Funcs.h"
@@ -12,6 +12,7 @@ GL_FUNC(void, glDeleteProgram, (GLuint))
 GL_FUNC(void, glDeleteShader, (GLuint))
 GL_FUNC(void, glDisable, (GLenum))
 GL_FUNC(void, glDrawElements, (GLenum, GLsizei, GLenum, const GLvoid*))
+GL_FUNC(void, glDrawElementsInstanced, (GLenum, GLsizei, GLenum, const GLvoid*, GLsizei))
 GL_FUNC(void, glEnable, (GLenum))
 GL_FUNC(void, glEnableVertexAttribArray, (GLuint))
 GL_FUNC(void, glFrontFace, (GLenum))
@@ -23,18 +24,27 @@ GL_FUNC(GLint, glGetUniformLocation, (GLuint, const char *))
 GL_FUNC(void, glLinkProgram, (GLuint))
 GL_FUNC(void, glShaderSource, (GLuint, GLsizei, const GLchar* const*, const GLint *))
 GL_FUNC(void, glUniform1i, (GLint, GLint))
+GL_FUNC(void, glUniform1iv, (GLint, GLsizei, const GLint *))
+GL_FUNC(void, glUniform1fv, (GLint, GLsizei, const GLfloat *))
 GL_FUNC(void, glUniform3fv, (GLint, GLsizei, const GLfloat *))
+GL_FUNC(void, glUniform4fv, (GLint, GLsizei, const GLfloat *))
 GL_FUNC(void, glUniform4f, (GLint, GLfloat, GLfloat, GLfloat, GLfloat))
 GL_FUNC(void, glUniformMatrix4fv, (GLint, GLsizei, GLboolean, const GLfloat *))
 GL_FUNC(void, glUseProgram, (GLuint))
 GL_FUNC(void, glValidateProgram, (GLuint))
 GL_FUNC(void, glVertexAttribPointer, (GLuint, GLint, GLenum, GLboolean, GLsizei, const void *))
+GL_FUNC(void, glVertexAttribDivisor, (GLuint, GLuint))
+GL_FUNC(void, glDisableVertexAttribArray, (GLuint))
 GL_FUNC(void, glViewport, (GLint, GLint, GLsizei, GLsizei))
 GL_FUNC(GLint, glGetAttribLocation, (GLuint, const GLchar *))
 GL_FUNC(void, glGenBuffers, (GLsizei, GLuint *))
 GL_FUNC(void, glDeleteBuffers, (GLsizei, GLuint *))
 GL_FUNC(void, glBindBuffer, (GLenum, GLuint))
 GL_FUNC(void, glBufferData, (GLenum, GLsizeiptr, const GLvoid *, GLenum))
+GL_FUNC(void, glBufferSubData, (GLenum, GLintptr, GLsizeiptr, const GLvoid *))
+GL_FUNC(void, glBindBufferBase, (GLenum, GLuint, GLuint))
+GL_FUNC(GLuint, glGetUniformBlockIndex, (GLuint, const GLchar *))
+GL_FUNC(void, glUniformBlockBinding, (GLuint, GLuint, GLuint))
 GL_FUNC(void, glDeleteVertexArrays, (GLsizei, const GLuint*))
 GL_FUNC(void, glBindTexture, (GLenum, GLuint))
 GL_FUNC(void, glGenTextures, (GLsizei, GLuint*))
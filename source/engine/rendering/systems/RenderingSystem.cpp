@@ -14,18 +14,23 @@
 #include "../components/WindowSingletonComponent.h"
 #include "../opengl/Context.h"
 #include "../utils/CameraUtils.h"
+#include "../utils/RenderQueueUtils.h"
+#include "../utils/UniformBlockUtils.h"
+#include "../../common/components/PreviousTransformComponent.h"
 #include "../../common/components/TransformComponent.h"
 #include "../../common/utils/FileUtils.h"
 #include "../../common/utils/Logging.h"
 #include "../../common/utils/MathUtils.h"
 #include "../../common/utils/OSMessageBox.h"
+#include "../../jobs/JobSystem.h"
 #include "../../resources/MeshResource.h"
 #include "../../resources/ResourceLoadingService.h"
 #include "../../resources/TextureResource.h"
 #include "../../sound/SoundService.h"
 
-#include <algorithm> // sort
+#include <algorithm> // min
 #include <cstdlib>   // exit
+#include <cstring>   // memcmp
 #include <SDL.h> 
 #include <vector>
 #include <iterator>
@@ -45,17 +50,19 @@ namespace rendering
 namespace
 {
     const StringId WORLD_MARIX_UNIFORM_NAME          = StringId("world");
-    const StringId VIEW_MARIX_UNIFORM_NAME           = StringId("view");
-    const StringId PROJECTION_MARIX_UNIFORM_NAME     = StringId("proj");
     const StringId NORMAL_MATRIX_UNIFORM_NAME        = StringId("norm");
-    const StringId MATERIAL_AMBIENT_UNIFORM_NAME     = StringId("material_ambient");
-    const StringId MATERIAL_DIFFUSE_UNIFORM_NAME     = StringId("material_diffuse");
-    const StringId MATERIAL_SPECULAR_UNIFORM_NAME    = StringId("material_specular");
-    const StringId MATERIAL_SHININESS_UNIFORM_NAME   = StringId("material_shininess");
-    const StringId LIGHT_POSITIONS_UNIFORM_NAME      = StringId("light_positions");
-    const StringId LIGHT_POWERS_UNIFORM_NAME         = StringId("light_powers");
-    const StringId EYE_POSITION_UNIFORM_NAME         = StringId("eye_pos");
-    const StringId IS_AFFECTED_BY_LIGHT_UNIFORM_NAME = StringId("is_affected_by_light");
+
+    const std::string INSTANCED_SHADER_VARIANT_SUFFIX = "_instanced";
+
+    const std::size_t FRUSTUM_CULLING_CHUNK_SIZE = 256U;
+    const std::size_t MIN_INSTANCED_BATCH_SIZE   = 4U;
+    
+    struct EntityRenderingEntry
+    {
+        TransformComponent mTransformComponent;
+        const RenderableComponent* mRenderableComponent;
+        bool mIsVisible;
+    };
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -68,11 +75,26 @@ bool IsMeshInsideCameraFrustum
     const CameraFrustum& cameraFrustum
 );
 
+static void CalculateWorldAndNormalMatrices
+(
+    const TransformComponent& transformComponent,
+    const RenderableComponent& renderableComponent,
+    const WindowSingletonComponent& windowComponent,
+    glm::mat4& worldMatrix,
+    glm::mat4& normalMatrix
+);
+
 ///-----------------------------------------------------------------------------------------------
 
-RenderingSystem::RenderingSystem()
-    : BaseSystem()
+RenderingSystem::RenderingSystem(ecs::World& world)
+    : BaseSystem(world)
 {
+    // All GL calls need to be issued from the thread owning the GL context
+    PinToMainThread();
+    SetUpdatePhase(ecs::SystemUpdatePhase::PRESENTATION);
+    DeclareReadAccess<WindowSingletonComponent, ShaderStoreSingletonComponent, LightStoreSingletonComponent>();
+    DeclareWriteAccess<CameraSingletonComponent, RenderingContextSingletonComponent>();
+    
     InitializeRenderingWindowAndContext();
     InitializeCamera();
     InitializeLights();
@@ -81,9 +103,9 @@ RenderingSystem::RenderingSystem()
 
 ///-----------------------------------------------------------------------------------------------
 
-void RenderingSystem::VUpdate(const float, const std::vector<ecs::EntityId>& entitiesToProcess) const
+void RenderingSystem::VUpdate(const float, const std::vector<ecs::EntityId>&) const
 {    
-    auto& world = ecs::World::GetInstance();
+    auto& world = GetWorld();
 
     // Get common rendering singleton components
     const auto& windowComponent      = world.GetSingletonComponent<WindowSingletonComponent>();
@@ -92,8 +114,22 @@ void RenderingSystem::VUpdate(const float, const std::vector<ecs::EntityId>& ent
     auto& cameraComponent            = world.GetSingletonComponent<CameraSingletonComponent>();
     auto& renderingContextComponent  = world.GetSingletonComponent<RenderingContextSingletonComponent>();
     
+    renderingContextComponent.mDrawCallCount    = 0;
+    renderingContextComponent.mInstanceCount    = 0;
+    renderingContextComponent.mShaderBindCount  = 0;
+    renderingContextComponent.mTextureBindCount = 0;
+    renderingContextComponent.mMeshBindCount    = 0;
+    renderingContextComponent.mMaterialUploadCount = 0;
+    renderingContextComponent.previousShaderParameters = nullptr;
+    
+    // The camera, like the transforms, is rendered in between the last two simulation ticks
+    const auto interpolationFactor = renderingContextComponent.mSimulationInterpolationFactor;
+    auto cameraFrontVector = glm::mix(cameraComponent.mPreviousFrontVector, cameraComponent.mFrontVector, interpolationFactor);
+    cameraFrontVector = glm::length(cameraFrontVector) > math::EQ_THRESHOLD ? glm::normalize(cameraFrontVector) : cameraComponent.mFrontVector;
+    cameraComponent.mEyePosition = glm::mix(cameraComponent.mPreviousPosition, cameraComponent.mPosition, interpolationFactor);
+    
     // Calculate render-constant camera view matrix
-    cameraComponent.mViewMatrix = glm::lookAtLH(cameraComponent.mPosition, cameraComponent.mPosition + cameraComponent.mFrontVector, cameraComponent.mUpVector);
+    cameraComponent.mViewMatrix = glm::lookAtLH(cameraComponent.mEyePosition, cameraComponent.mEyePosition + cameraFrontVector, cameraComponent.mUpVector);
     
     // Calculate render-constant camera projection matrix
     cameraComponent.mProjectionMatrix = glm::perspectiveFovLH
@@ -109,9 +145,56 @@ void RenderingSystem::VUpdate(const float, const std::vector<ecs::EntityId>& ent
     // Calculate the camera frustum for this frame
     cameraComponent.mFrustum = CalculateCameraFrustum(cameraComponent.mViewMatrix, cameraComponent.mProjectionMatrix);
     
-    // Collect all entities that need to be processed
-    std::vector<ecs::EntityId> applicableEntities = entitiesToProcess;
-    std::vector<genesis::ecs::EntityId> guiEntities;    
+    // Upload the camera and light data shared by all draw calls of the frame
+    FrameUniformBlock frameUniformBlock = {};
+    frameUniformBlock.mViewMatrix       = cameraComponent.mViewMatrix;
+    frameUniformBlock.mProjectionMatrix = cameraComponent.mProjectionMatrix;
+    frameUniformBlock.mEyePosition      = glm::vec4(cameraComponent.mEyePosition, 1.0f);
+    
+    const auto lightCount = std::min(MAX_LIGHT_COUNT, std::min(lightStoreComponent.mLightPositions.size(), lightStoreComponent.mLightPowers.size()));
+    for (auto i = 0U; i < lightCount; ++i)
+    {
+        frameUniformBlock.mLights[i] = glm::vec4(lightStoreComponent.mLightPositions[i], lightStoreComponent.mLightPowers[i]);
+    }
+    
+    UploadUniformBuffer(renderingContextComponent.mFrameUniformBufferObject, &frameUniformBlock, sizeof(frameUniformBlock));
+    
+    // Collect the components of all entities that need to be processed
+    const auto renderingView = GetView();
+    
+    std::vector<EntityRenderingEntry> applicableEntities;
+    applicableEntities.reserve(renderingView.GetEntityCount());
+    
+    // Transforms are rendered in between the last two simulation ticks, so that motion stays smooth regardless of the frame rate
+    renderingView.ForEach([&applicableEntities, interpolationFactor](const ecs::EntityId, const TransformComponent& transformComponent, const PreviousTransformComponent& previousTransformComponent, const RenderableComponent& renderableComponent)
+    {
+        auto interpolatedTransformComponent = transformComponent;
+        interpolatedTransformComponent.mPosition = glm::mix(previousTransformComponent.mPosition, transformComponent.mPosition, interpolationFactor);
+        interpolatedTransformComponent.mRotation = glm::mix(previousTransformComponent.mRotation, transformComponent.mRotation, interpolationFactor);
+        interpolatedTransformComponent.mScale    = glm::mix(previousTransformComponent.mScale, transformComponent.mScale, interpolationFactor);
+        
+        applicableEntities.push_back(EntityRenderingEntry{ interpolatedTransformComponent, &renderableComponent, true });
+    });
+    
+    // Frustum culling is independent per entity, so it is performed concurrently ahead of issuing any draw calls
+    jobs::ParallelFor(applicableEntities, FRUSTUM_CULLING_CHUNK_SIZE, [&cameraComponent](EntityRenderingEntry& entityRenderingEntry)
+    {
+        if (entityRenderingEntry.mRenderableComponent->mIsGuiComponent)
+        {
+            return;
+        }
+        
+        const auto& transformComponent = entityRenderingEntry.mTransformComponent;
+        const auto& currentMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(entityRenderingEntry.mRenderableComponent->mMeshResourceId);
+        
+        entityRenderingEntry.mIsVisible = IsMeshInsideCameraFrustum
+        (
+            transformComponent.mPosition,
+            transformComponent.mScale,
+            currentMesh.GetDimensions(),
+            cameraComponent.mFrustum
+        );
+    });
     
     // Set background color
     GL_CHECK(glClearColor
@@ -125,72 +208,96 @@ void RenderingSystem::VUpdate(const float, const std::vector<ecs::EntityId>& ent
     // Clear buffers
     GL_CHECK(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
 
-    // Enable depth
-    GL_CHECK(glEnable(GL_DEPTH_TEST));
+    // Build the render queue out of the visible entities, keyed by pass, GL state and depth
+    std::vector<DrawItem> drawItems;
+    drawItems.reserve(applicableEntities.size());
+    for (auto i = 0U; i < applicableEntities.size(); ++i)
+    {
+        const auto& entityRenderingEntry = applicableEntities[i];
+        const auto& renderableComponent  = *entityRenderingEntry.mRenderableComponent;
+        if (!entityRenderingEntry.mIsVisible || !renderableComponent.mIsVisible)
+        {
+            continue;
+        }
+        
+        // Gui elements are layered by their z coordinate, while geometry by its view space depth
+        const auto& position = entityRenderingEntry.mTransformComponent.mPosition;
+        const auto renderPass = renderableComponent.mIsGuiComponent ? RenderPass::GUI : renderableComponent.mIsTransparent ? RenderPass::TRANSPARENT_GEOMETRY : RenderPass::OPAQUE_GEOMETRY;
+        const auto depth      = renderPass == RenderPass::GUI ? position.z : (cameraComponent.mViewMatrix * glm::vec4(position, 1.0f)).z;
         
-    // Sort entities based on their depth order to correct transparency
-    std::sort(applicableEntities.begin(), applicableEntities.end(), [&world](const genesis::ecs::EntityId& lhs, const genesis::ecs::EntityId& rhs)
+        drawItems.push_back(DrawItem{ CreateDrawItemSortKey(renderPass, renderableComponent.mShaderNameId, renderableComponent.mTextureResourceId, renderableComponent.mMeshResourceId, depth), i });
+    }
+    
+    std::vector<DrawItem> scratchDrawItems;
+    SortDrawItems(drawItems, scratchDrawItems);
+    
+    // Runs of draws sharing shader, texture and mesh, with no per entity state beyond what the instance data holds, become single instanced draws
+    std::vector<DrawBatch> drawBatches;
+    FormDrawBatches(drawItems, MIN_INSTANCED_BATCH_SIZE, [&applicableEntities, &shaderStoreComponent](const DrawItem& batchDrawItem, const DrawItem& drawItem)
     {
-        const auto& lhsTransformComponent = world.GetComponent<TransformComponent>(lhs);
-        const auto& rhsTransformComponent = world.GetComponent<TransformComponent>(rhs);
-
-        return lhsTransformComponent.mPosition.z > rhsTransformComponent.mPosition.z;
-    });
-
-    for (const auto& entityId : applicableEntities)
+        return CanShareInstancedDraw
+        (
+            batchDrawItem,
+            *applicableEntities[batchDrawItem.mEntryIndex].mRenderableComponent,
+            drawItem,
+            *applicableEntities[drawItem.mEntryIndex].mRenderableComponent,
+            shaderStoreComponent.mInstancedShaderVariantNames
+        );
+    }, drawBatches);
+    
+    // Enable depth
+    GL_CHECK(glEnable(GL_DEPTH_TEST));
+    
+    auto isDepthTestEnabled = true;
+    for (const auto& drawBatch: drawBatches)
     {
-        const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
-        if (renderableComponent.mIsGuiComponent)
+        const auto& batchDrawItem = drawItems[drawBatch.mFirstDrawItemIndex];
+        
+        // Execute GUI render pass
+        if (isDepthTestEnabled && GetDrawItemRenderPass(batchDrawItem.mSortKey) == RenderPass::GUI)
         {
-            guiEntities.push_back(entityId);
-            continue;
+            GL_CHECK(glDisable(GL_DEPTH_TEST));
+            isDepthTestEnabled = false;
         }
-        else
+        
+        const auto& batchEntityRenderingEntry = applicableEntities[batchDrawItem.mEntryIndex];
+        if (!drawBatch.mIsInstanced)
         {
-            const auto& transformComponent = world.GetComponent<TransformComponent>(entityId);
-            const auto& currentMesh        = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceId);
-
-            // Frustum culling
-            if (!IsMeshInsideCameraFrustum
-            (
-                transformComponent.mPosition,
-                transformComponent.mScale,
-                currentMesh.GetDimensions(),
-                cameraComponent.mFrustum
-            ))
-            {
-                continue;
-            }
-
             RenderEntityInternal
             (
-                transformComponent,
-                renderableComponent,
-                cameraComponent,
-                lightStoreComponent,
+                batchEntityRenderingEntry.mTransformComponent,
+                *batchEntityRenderingEntry.mRenderableComponent,
                 shaderStoreComponent,
                 windowComponent,
                 renderingContextComponent
             );
+            continue;
         }
-    }
-    
-    // Execute GUI render pass
-    GL_CHECK(glDisable(GL_DEPTH_TEST));
-    
-    for (const auto& entityId : guiEntities)
-    {
-        const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
-        const auto& transformComponent = world.GetComponent<TransformComponent>(entityId);
-
-        RenderEntityInternal
-        (            
-            transformComponent,
-            renderableComponent,            
-            cameraComponent,
-            lightStoreComponent,
+        
+        auto& instanceData = renderingContextComponent.mInstanceData;
+        instanceData.resize(drawBatch.mDrawItemCount);
+        for (auto i = 0U; i < drawBatch.mDrawItemCount; ++i)
+        {
+            const auto& entityRenderingEntry = applicableEntities[drawItems[drawBatch.mFirstDrawItemIndex + i].mEntryIndex];
+            const auto& renderableComponent  = *entityRenderingEntry.mRenderableComponent;
+            
+            auto& instance = instanceData[i];
+            CalculateWorldAndNormalMatrices(entityRenderingEntry.mTransformComponent, renderableComponent, windowComponent, instance.mWorldMatrix, instance.mNormalMatrix);
+            instance.mMaterialAmbient    = renderableComponent.mMaterial.mAmbient;
+            instance.mMaterialDiffuse    = renderableComponent.mMaterial.mDiffuse;
+            instance.mMaterialSpecular   = renderableComponent.mMaterial.mSpecular;
+            instance.mMaterialProperties = glm::vec4(renderableComponent.mMaterial.mShininess, renderableComponent.mIsAffectedByLight ? 1.0f : 0.0f, 0.0f, 0.0f);
+            instance.mCustomColor        = glm::vec4(0.0f);
+            if (renderableComponent.mShaderParameters != nullptr)
+            {
+                renderableComponent.mShaderParameters->GetFloatVec4(CUSTOM_COLOR_UNIFORM_NAME, instance.mCustomColor);
+            }
+        }
+        
+        RenderInstancedBatchInternal
+        (
+            *batchEntityRenderingEntry.mRenderableComponent,
             shaderStoreComponent,
-            windowComponent,            
             renderingContextComponent
         );
     }
@@ -205,8 +312,6 @@ void RenderingSystem::RenderEntityInternal
 (    
     const TransformComponent& transformComponent,
     const RenderableComponent& renderableComponent,    
-    const CameraSingletonComponent& cameraComponent,
-    const LightStoreSingletonComponent& lightStoreComponent,
     const ShaderStoreSingletonComponent& shaderStoreComponent,
     const WindowSingletonComponent& windowComponent,    
     RenderingContextSingletonComponent& renderingContextComponent    
@@ -217,129 +322,138 @@ void RenderingSystem::RenderEntityInternal
         return;
     }
 
-    // Update Shader is necessary
-    const resources::ShaderResource* currentShader = nullptr;
-    if (renderableComponent.mShaderNameId != renderingContextComponent.previousShaderNameId)
+    BindRenderStateInternal(renderableComponent.mShaderNameId, renderableComponent, shaderStoreComponent, renderingContextComponent);
+    
+    const auto* currentShader = renderingContextComponent.previousShader;
+    const auto* currentMesh   = renderingContextComponent.previousMesh;
+    
+    // Calculate world matrix for entity
+    glm::mat4 world;
+    glm::mat4 rotMatrix;
+    CalculateWorldAndNormalMatrices(transformComponent, renderableComponent, windowComponent, world, rotMatrix);
+
+    // Set per draw uniforms (camera and lights are shared through the frame uniform block)
+    currentShader->SetUniform(renderingContextComponent.previousShaderWorldMatrixUniform, world);
+    currentShader->SetUniform(renderingContextComponent.previousShaderNormalMatrixUniform, rotMatrix);
+    
+    // Upload the material only when it differs from that of the previous draw call
+    MaterialUniformBlock materialUniformBlock = {};
+    materialUniformBlock.mAmbient           = renderableComponent.mMaterial.mAmbient;
+    materialUniformBlock.mDiffuse           = renderableComponent.mMaterial.mDiffuse;
+    materialUniformBlock.mSpecular          = renderableComponent.mMaterial.mSpecular;
+    materialUniformBlock.mShininess         = renderableComponent.mMaterial.mShininess;
+    materialUniformBlock.mIsAffectedByLight = renderableComponent.mIsAffectedByLight ? 1 : 0;
+    
+    if (!renderingContextComponent.mHasUploadedMaterial || std::memcmp(&materialUniformBlock, &renderingContextComponent.mUploadedMaterialUniformBlock, sizeof(materialUniformBlock)) != 0)
     {
-        currentShader = &shaderStoreComponent.mShaders.at(renderableComponent.mShaderNameId);
-        GL_CHECK(glUseProgram(currentShader->GetProgramId()));
+        UploadUniformBuffer(renderingContextComponent.mMaterialUniformBufferObject, &materialUniformBlock, sizeof(materialUniformBlock));
+        renderingContextComponent.mUploadedMaterialUniformBlock = materialUniformBlock;
+        renderingContextComponent.mHasUploadedMaterial          = true;
+        renderingContextComponent.mMaterialUploadCount++;
+    }
+    
+    // Set the material's custom parameters, unless the same (unmodified) block was the last one applied to the bound shader
+    const auto* shaderParameters = renderableComponent.mShaderParameters.get();
+    if (shaderParameters != nullptr &&
+        (shaderParameters != renderingContextComponent.previousShaderParameters ||
+         shaderParameters->GetVersion() != renderingContextComponent.previousShaderParametersVersion ||
+         renderingContextComponent.previousShaderNameId != renderingContextComponent.previousShaderParametersShaderNameId))
+    {
+        currentShader->SetParameters(*shaderParameters);
+        
+        renderingContextComponent.previousShaderParameters              = shaderParameters;
+        renderingContextComponent.previousShaderParametersVersion       = shaderParameters->GetVersion();
+        renderingContextComponent.previousShaderParametersShaderNameId  = renderingContextComponent.previousShaderNameId;
+    }
+    
+    // Perform draw call
+    GL_CHECK(glDrawElements(GL_TRIANGLES, currentMesh->GetElementCount(), GL_UNSIGNED_SHORT, (void*)0));
+    renderingContextComponent.mDrawCallCount++;
+}
+
+///-----------------------------------------------------------------------------------------------
 
-        renderingContextComponent.previousShaderNameId = renderableComponent.mShaderNameId;
-        renderingContextComponent.previousShader       = currentShader;
+void RenderingSystem::RenderInstancedBatchInternal
+(
+    const RenderableComponent& batchRenderableComponent,
+    const ShaderStoreSingletonComponent& shaderStoreComponent,
+    RenderingContextSingletonComponent& renderingContextComponent
+) const
+{
+    const auto& instancedShaderNameId = shaderStoreComponent.mInstancedShaderVariantNames.at(batchRenderableComponent.mShaderNameId);
+    BindRenderStateInternal(instancedShaderNameId, batchRenderableComponent, shaderStoreComponent, renderingContextComponent);
+    
+    const auto* currentMesh  = renderingContextComponent.previousMesh;
+    const auto& instanceData = renderingContextComponent.mInstanceData;
+    
+    // Upload the instance data. Respecifying the whole buffer orphans its previous contents, so that the upload does not wait on prior draws
+    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, renderingContextComponent.mInstanceBufferObject));
+    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, instanceData.size() * sizeof(InstanceData), instanceData.data(), GL_STREAM_DRAW));
+    
+    // Point the per instance attributes of the bound mesh at the instance data
+    for (auto i = 0U; i < INSTANCE_ATTRIBUTE_LOCATION_COUNT; ++i)
+    {
+        GL_CHECK(glEnableVertexAttribArray(FIRST_INSTANCE_ATTRIBUTE_LOCATION + i));
+        GL_CHECK(glVertexAttribPointer(FIRST_INSTANCE_ATTRIBUTE_LOCATION + i, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(i * sizeof(glm::vec4))));
+        GL_CHECK(glVertexAttribDivisor(FIRST_INSTANCE_ATTRIBUTE_LOCATION + i, 1));
     }
-    else
+    
+    // Perform instanced draw call
+    GL_CHECK(glDrawElementsInstanced(GL_TRIANGLES, currentMesh->GetElementCount(), GL_UNSIGNED_SHORT, (void*)0, static_cast<GLsizei>(instanceData.size())));
+    renderingContextComponent.mDrawCallCount++;
+    renderingContextComponent.mInstanceCount += static_cast<int>(instanceData.size());
+    
+    // Leave the mesh's vertex array as it was, for subsequent non instanced draws of it
+    for (auto i = 0U; i < INSTANCE_ATTRIBUTE_LOCATION_COUNT; ++i)
     {
-        currentShader = renderingContextComponent.previousShader;
+        GL_CHECK(glDisableVertexAttribArray(FIRST_INSTANCE_ATTRIBUTE_LOCATION + i));
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::BindRenderStateInternal
+(
+    const StringId& shaderNameId,
+    const RenderableComponent& renderableComponent,
+    const ShaderStoreSingletonComponent& shaderStoreComponent,
+    RenderingContextSingletonComponent& renderingContextComponent
+) const
+{
+    // Update Shader is necessary
+    if (shaderNameId != renderingContextComponent.previousShaderNameId)
+    {
+        const auto* currentShader = &shaderStoreComponent.mShaders.at(shaderNameId);
+        GL_CHECK(glUseProgram(currentShader->GetProgramId()));
+        renderingContextComponent.mShaderBindCount++;
+
+        renderingContextComponent.previousShaderNameId              = shaderNameId;
+        renderingContextComponent.previousShader                    = currentShader;
+        renderingContextComponent.previousShaderWorldMatrixUniform  = currentShader->GetUniformHandle<glm::mat4>(WORLD_MARIX_UNIFORM_NAME);
+        renderingContextComponent.previousShaderNormalMatrixUniform = currentShader->GetUniformHandle<glm::mat4>(NORMAL_MATRIX_UNIFORM_NAME);
     }
 
     // Update current mesh if necessary
-    const resources::MeshResource* currentMesh = nullptr;
     if (renderableComponent.mMeshResourceId != renderingContextComponent.previousMeshResourceId)
     {
-        currentMesh = &resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceId);
+        const auto* currentMesh = &resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceId);
         GL_CHECK(glBindVertexArray(currentMesh->GetVertexArrayObject()));
+        renderingContextComponent.mMeshBindCount++;
 
         renderingContextComponent.previousMesh           = currentMesh;
         renderingContextComponent.previousMeshResourceId = renderableComponent.mMeshResourceId;
     }
-    else
-    {
-        currentMesh = renderingContextComponent.previousMesh;
-    }
-        
-    // Calculate world matrix for entity
-    glm::mat4 world(1.0f);
-        
-    // Correct display of hud and billboard entities    
-    glm::vec3 position = transformComponent.mPosition;
-    glm::vec3 scale    = transformComponent.mScale;
-    glm::vec3 rotation = transformComponent.mRotation;
-
-    if (renderableComponent.mIsGuiComponent)
-    {        
-        scale.x /= windowComponent.mAspectRatio;        
-    }  
-    
-    glm::mat4 rotMatrix = glm::mat4_cast(math::EulerAnglesToQuat(rotation));
-    
-    world = glm::translate(world, position);
-    world *= rotMatrix;
-    world = glm::scale(world, scale);
-       
 
     // Update texture if necessary
-    const resources::TextureResource* currentTexture = nullptr;
     if (renderableComponent.mTextureResourceId != renderingContextComponent.previousTextureResourceId)
     {
-        currentTexture = &resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(renderableComponent.mTextureResourceId);
+        const auto* currentTexture = &resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(renderableComponent.mTextureResourceId);
         GL_CHECK(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
+        renderingContextComponent.mTextureBindCount++;
 
-        renderingContextComponent.previousTexture = currentTexture;
+        renderingContextComponent.previousTexture           = currentTexture;
         renderingContextComponent.previousTextureResourceId = renderableComponent.mTextureResourceId;
     }
-    else
-    {
-        currentTexture = renderingContextComponent.previousTexture;
-    }      
-
-    // Set mvp uniforms    
-    currentShader->SetMatrix4fv(WORLD_MARIX_UNIFORM_NAME, world);
-    currentShader->SetMatrix4fv(VIEW_MARIX_UNIFORM_NAME, cameraComponent.mViewMatrix);
-    currentShader->SetMatrix4fv(PROJECTION_MARIX_UNIFORM_NAME, cameraComponent.mProjectionMatrix);    
-    currentShader->SetMatrix4fv(NORMAL_MATRIX_UNIFORM_NAME, rotMatrix);
-    currentShader->SetFloatVec4(MATERIAL_AMBIENT_UNIFORM_NAME, renderableComponent.mMaterial.mAmbient);
-    currentShader->SetFloatVec4(MATERIAL_DIFFUSE_UNIFORM_NAME, renderableComponent.mMaterial.mDiffuse);
-    currentShader->SetFloatVec4(MATERIAL_SPECULAR_UNIFORM_NAME, renderableComponent.mMaterial.mSpecular);
-    currentShader->SetFloat(MATERIAL_SHININESS_UNIFORM_NAME, renderableComponent.mMaterial.mShininess);
-    currentShader->SetFloatVec3Array(LIGHT_POSITIONS_UNIFORM_NAME, lightStoreComponent.mLightPositions);
-    currentShader->SetFloatArray(LIGHT_POWERS_UNIFORM_NAME, lightStoreComponent.mLightPowers);
-    currentShader->SetInt(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME, renderableComponent.mIsAffectedByLight ? 1 : 0);
-    currentShader->SetFloatVec3(EYE_POSITION_UNIFORM_NAME, cameraComponent.mPosition);
-    
-    // Set other matrix uniforms
-    for (const auto& matrixUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixUniforms)
-    {
-        currentShader->SetMatrix4fv(matrixUniformEntry.first, matrixUniformEntry.second);
-    }
-
-    // Set other float vec4 array uniforms
-    for (const auto& vec4arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderFloatVec4ArrayUniforms)
-    {
-        currentShader->SetFloatVec4Array(vec4arrayUniformEntry.first, vec4arrayUniformEntry.second);
-    }
-    
-    // Set other float vec3 array uniforms
-    for (const auto& vec3arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderFloatVec3ArrayUniforms)
-    {
-        currentShader->SetFloatVec3Array(vec3arrayUniformEntry.first, vec3arrayUniformEntry.second);
-    }
-    
-    // Set other float vec4 uniforms
-    for (const auto& floatVec4UniformEntry : renderableComponent.mShaderUniforms.mShaderFloatVec4Uniforms)
-    {
-        currentShader->SetFloatVec4(floatVec4UniformEntry.first, floatVec4UniformEntry.second);
-    }
-    
-    // Set other float vec3 uniforms
-    for (const auto& floatVec3UniformEntry : renderableComponent.mShaderUniforms.mShaderFloatVec3Uniforms)
-    {
-        currentShader->SetFloatVec3(floatVec3UniformEntry.first, floatVec3UniformEntry.second);
-    }
-    
-    // Set other float uniforms
-    for (const auto& floatUniformEntry : renderableComponent.mShaderUniforms.mShaderFloatUniforms)
-    {
-        currentShader->SetFloat(floatUniformEntry.first, floatUniformEntry.second);
-    }
-    
-    // Set other int uniforms
-    for (const auto& intUniformEntry : renderableComponent.mShaderUniforms.mShaderIntUniforms)
-    {
-        currentShader->SetInt(intUniformEntry.first, intUniformEntry.second);
-    }
-    
-    // Perform draw call
-    GL_CHECK(glDrawElements(GL_TRIANGLES, currentMesh->GetElementCount(), GL_UNSIGNED_SHORT, (void*)0));
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -348,7 +462,7 @@ void RenderingSystem::InitializeRenderingWindowAndContext() const
 {    
     // Create SDL GL context
     auto renderingContextComponent = std::make_unique<RenderingContextSingletonComponent>();
-    auto& windowComponent = ecs::World::GetInstance().GetSingletonComponent<WindowSingletonComponent>();
+    auto& windowComponent = GetWorld().GetSingletonComponent<WindowSingletonComponent>();
 
     renderingContextComponent->mGLContext = SDL_GL_CreateContext(windowComponent.mWindowHandle);
     if (renderingContextComponent->mGLContext == nullptr)
@@ -388,29 +502,36 @@ void RenderingSystem::InitializeRenderingWindowAndContext() const
     GL_CHECK(glEnable(GL_DEPTH_TEST));
     GL_CHECK(glDepthFunc(GL_LESS));    
     
+    // Create the buffer holding the per instance data of instanced draw calls
+    GL_CHECK(glGenBuffers(1, &renderingContextComponent->mInstanceBufferObject));
+    
+    // Create the uniform buffers shared by all shaders
+    renderingContextComponent->mFrameUniformBufferObject    = CreateUniformBuffer(FRAME_UNIFORM_BLOCK_BINDING, sizeof(FrameUniformBlock));
+    renderingContextComponent->mMaterialUniformBufferObject = CreateUniformBuffer(MATERIAL_UNIFORM_BLOCK_BINDING, sizeof(MaterialUniformBlock));
+    
     // Transfer ownership of singleton components to world    
-    ecs::World::GetInstance().SetSingletonComponent<RenderingContextSingletonComponent>(std::move(renderingContextComponent));
+    GetWorld().SetSingletonComponent<RenderingContextSingletonComponent>(std::move(renderingContextComponent));
 }
 
 ///-----------------------------------------------------------------------------------------------
 
 void RenderingSystem::InitializeCamera() const
 {        
-    ecs::World::GetInstance().SetSingletonComponent<CameraSingletonComponent>(std::make_unique<CameraSingletonComponent>());
+    GetWorld().SetSingletonComponent<CameraSingletonComponent>(std::make_unique<CameraSingletonComponent>());
 }
 
 ///-----------------------------------------------------------------------------------------------
 
 void RenderingSystem::InitializeLights() const
 {
-    ecs::World::GetInstance().SetSingletonComponent<LightStoreSingletonComponent>(std::make_unique<LightStoreSingletonComponent>());
+    GetWorld().SetSingletonComponent<LightStoreSingletonComponent>(std::make_unique<LightStoreSingletonComponent>());
 }
 
 ///-----------------------------------------------------------------------------------------------
 
 void RenderingSystem::CompileAndLoadShaders() const
 {
-    auto& renderingContextComponent = ecs::World::GetInstance().GetSingletonComponent<RenderingContextSingletonComponent>();
+    auto& renderingContextComponent = GetWorld().GetSingletonComponent<RenderingContextSingletonComponent>();
     
     // Bind default VAO for correct shader compilation
     GL_CHECK(glGenVertexArrays(1, &renderingContextComponent.mDefaultVertexArrayObject));
@@ -431,12 +552,18 @@ void RenderingSystem::CompileAndLoadShaders() const
         
         // And unload the resource
         resources::ResourceLoadingService::GetInstance().UnloadResource(shaderResourceId);
+        
+        // Shaders named <name>_instanced are the instanced variants of the shader <name>
+        if (StringEndsWith(shaderName, INSTANCED_SHADER_VARIANT_SUFFIX))
+        {
+            shaderStoreComponent->mInstancedShaderVariantNames[StringId(shaderName.substr(0, shaderName.size() - INSTANCED_SHADER_VARIANT_SUFFIX.size()))] = StringId(shaderName);
+        }
     }
-    
+
     // Unbind any VAO currently bound
     GL_CHECK(glBindVertexArray(0));
     
-    ecs::World::GetInstance().SetSingletonComponent<ShaderStoreSingletonComponent>(std::move(shaderStoreComponent));
+    GetWorld().SetSingletonComponent<ShaderStoreSingletonComponent>(std::move(shaderStoreComponent));
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -480,6 +607,31 @@ bool IsMeshInsideCameraFrustum
     return true;
 }
 
+///-----------------------------------------------------------------------------------------------
+
+void CalculateWorldAndNormalMatrices
+(
+    const TransformComponent& transformComponent,
+    const RenderableComponent& renderableComponent,
+    const WindowSingletonComponent& windowComponent,
+    glm::mat4& worldMatrix,
+    glm::mat4& normalMatrix
+)
+{
+    // Correct display of hud and billboard entities    
+    glm::vec3 scale = transformComponent.mScale;
+    if (renderableComponent.mIsGuiComponent)
+    {
+        scale.x /= windowComponent.mAspectRatio;
+    }
+    
+    normalMatrix = glm::mat4_cast(math::EulerAnglesToQuat(transformComponent.mRotation));
+    
+    worldMatrix = glm::translate(glm::mat4(1.0f), transformComponent.mPosition);
+    worldMatrix *= normalMatrix;
+    worldMatrix = glm::scale(worldMatrix, scale);
+}
+
 }
 
 }
@@ -25,6 +25,7 @@ namespace genesis
 
 ///-----------------------------------------------------------------------------------------------
 
+class PreviousTransformComponent;
 class TransformComponent;
 
 ///-----------------------------------------------------------------------------------------------
@@ -43,10 +44,10 @@ class LightStoreSingletonComponent;
 
 ///-----------------------------------------------------------------------------------------------
 
-class RenderingSystem final: public ecs::BaseSystem<TransformComponent, RenderableComponent>
+class RenderingSystem final: public ecs::BaseSystem<const TransformComponent, const PreviousTransformComponent, const RenderableComponent>
 {
 public:
-    RenderingSystem();
+    RenderingSystem(ecs::World& world);
     
     void VUpdate(const float dt, const std::vector<ecs::EntityId>&) const override;
 
@@ -55,12 +56,25 @@ private:
     (        
         const TransformComponent& entityTransformComponent,
         const RenderableComponent& entityRenderableComponent,        
-        const CameraSingletonComponent& globalCameraComponent,
-        const LightStoreSingletonComponent& lightStoreComponent,
         const ShaderStoreSingletonComponent& globalShaderStoreComponent,
         const WindowSingletonComponent& globalWindowComponent,        
         RenderingContextSingletonComponent& renderingContextComponent        
     ) const;
+    
+    void RenderInstancedBatchInternal
+    (
+        const RenderableComponent& batchRenderableComponent,
+        const ShaderStoreSingletonComponent& globalShaderStoreComponent,
+        RenderingContextSingletonComponent& renderingContextComponent
+    ) const;
+    
+    void BindRenderStateInternal
+    (
+        const StringId& shaderNameId,
+        const RenderableComponent& entityRenderableComponent,
+        const ShaderStoreSingletonComponent& globalShaderStoreComponent,
+        RenderingContextSingletonComponent& renderingContextComponent
+    ) const;
         
     void InitializeRenderingWindowAndContext() const;
     void InitializeCamera() const;
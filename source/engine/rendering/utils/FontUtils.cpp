@@ -14,6 +14,8 @@
 #include "../../resources/ResourceLoadingService.h"
 #include "../../resources/DataFileResource.h"
 
+#include <memory>
+
 ///------------------------------------------------------------------------------------------------
 
 namespace genesis
@@ -41,12 +43,12 @@ namespace
 
 void LoadFont
 (
+    ecs::World& world,
     const StringId& fontName,
     const int fontAtlasCols,
     const int fontAtlasRows
 )
 {
-    auto& world = ecs::World::GetInstance();
 
     // Get/Create the font store component
     if (!world.HasSingletonComponent<FontsStoreSingletonComponent>())
@@ -98,40 +100,63 @@ void LoadFont
 
 ///-----------------------------------------------------------------------------------------------
 
-ecs::EntityId RenderCharacter
+static ecs::EntityId RenderCharacterInternal
 (
+    ecs::World& world,
     const char character,
     const StringId& fontName,
     const float size,
     const glm::vec3& position,
-    const glm::vec4& color /* glm::vec4(0.0f, 0.0f, 0.0f, 0.0f) */
+    const std::shared_ptr<ShaderParameterBlock>& shaderParameters
 )
 {    
-    auto& world = ecs::World::GetInstance();
     auto& fontStoreComponent = world.GetSingletonComponent<FontsStoreSingletonComponent>();
 
-    auto renderableComponent = std::make_unique<RenderableComponent>();
-    renderableComponent->mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource(resources::ResourceLoadingService::RES_ATLASES_ROOT + fontName.GetString() + FONT_ATLAS_TEXTURE_FILE_EXTENSION);    
-    renderableComponent->mShaderNameId = FONT_SHADER_NAME;
-    renderableComponent->mIsGuiComponent = true;
-    renderableComponent->mMeshResourceId = fontStoreComponent.mLoadedFonts.at(fontName).at(character);
-    renderableComponent->mShaderUniforms.mShaderFloatVec4Uniforms[GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME] = color;
+    const auto characterEntity = world.CreateEntity();
 
-    auto transformComponent = std::make_unique<TransformComponent>();    
-    transformComponent->mPosition = position;
-    transformComponent->mScale = glm::vec3(size);
+    auto& renderableComponent = world.AddComponent<RenderableComponent>(characterEntity);
+    renderableComponent.mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource(resources::ResourceLoadingService::RES_ATLASES_ROOT + fontName.GetString() + FONT_ATLAS_TEXTURE_FILE_EXTENSION);    
+    renderableComponent.mShaderNameId = FONT_SHADER_NAME;
+    renderableComponent.mIsGuiComponent = true;
+    renderableComponent.mMeshResourceId = fontStoreComponent.mLoadedFonts.at(fontName).at(character);
+    renderableComponent.mShaderParameters = shaderParameters;
 
-    const auto characterEntity = world.CreateEntity();
-    world.AddComponent<RenderableComponent>(characterEntity, std::move(renderableComponent));
-    world.AddComponent<TransformComponent>(characterEntity, std::move(transformComponent));
+    auto& transformComponent = world.AddComponent<TransformComponent>(characterEntity);
+    transformComponent.mPosition = position;
+    transformComponent.mScale = glm::vec3(size);
 
     return characterEntity;
 }
 
 ///-----------------------------------------------------------------------------------------------
 
+static std::shared_ptr<ShaderParameterBlock> CreateTextShaderParameters(const glm::vec4& color)
+{
+    auto shaderParameters = std::make_shared<ShaderParameterBlock>();
+    shaderParameters->SetFloatVec4(GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME, color);
+    return shaderParameters;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+ecs::EntityId RenderCharacter
+(
+    ecs::World& world,
+    const char character,
+    const StringId& fontName,
+    const float size,
+    const glm::vec3& position,
+    const glm::vec4& color /* glm::vec4(0.0f, 0.0f, 0.0f, 0.0f) */
+)
+{
+    return RenderCharacterInternal(world, character, fontName, size, position, CreateTextShaderParameters(color));
+}
+
+///-----------------------------------------------------------------------------------------------
+
 ecs::EntityId RenderText
 (
+    ecs::World& world,
     const std::string& text,
     const StringId& fontName,
     const float size,
@@ -139,9 +164,11 @@ ecs::EntityId RenderText
     const glm::vec4& color /* glm::vec4(0.0f, 0.0f, 0.0f, 0.0f) */
 )
 {
-    auto& world = ecs::World::GetInstance();
     auto& fontStoreComponent = world.GetSingletonComponent<FontsStoreSingletonComponent>();
-    auto textStringComponent = std::make_unique<TextStringComponent>();
+    TextStringComponent textStringComponent;
+
+    // All characters of the string share the same shader parameters
+    const auto shaderParameters = CreateTextShaderParameters(color);
 
     auto positionCounter = position;
     for (const auto& character : text)
@@ -151,13 +178,13 @@ ecs::EntityId RenderText
             continue;
         }
         
-        const auto characterEntityId = RenderCharacter(character, fontName, size, positionCounter, color);
-        textStringComponent->mTextCharacterEntities.push_back(CharacterEntry(characterEntityId, character));
+        const auto characterEntityId = RenderCharacterInternal(world, character, fontName, size, positionCounter, shaderParameters);
+        textStringComponent.mTextCharacterEntities.push_back(CharacterEntry(characterEntityId, character));
         
         positionCounter.x += size * FONT_PADDING_PROPORTION_TO_SIZE;
     }    
 
-    textStringComponent->mCharacterSize = size;
+    textStringComponent.mCharacterSize = size;
 
     auto entity = world.CreateEntity();
     world.AddComponent<TextStringComponent>(entity, std::move(textStringComponent));
@@ -169,6 +196,7 @@ ecs::EntityId RenderText
 
 ecs::EntityId RenderTextIfDifferentToPreviousString
 (
+    ecs::World& world,
     const std::string& text,
     const ecs::EntityId previousString,
     const StringId& fontName,
@@ -177,27 +205,27 @@ ecs::EntityId RenderTextIfDifferentToPreviousString
     const glm::vec4& color /* glm::vec4(0.0f, 0.0f, 0.0f, 0.0f) */
 )
 {
-    if (previousString != ecs::NULL_ENTITY_ID && IsTextStringTheSameAsText(previousString, text))
+    if (previousString != ecs::NULL_ENTITY_ID && IsTextStringTheSameAsText(world, previousString, text))
     {
         return previousString;
     }
     
     if (previousString != ecs::NULL_ENTITY_ID)
     {
-        DestroyRenderedText(previousString);
+        DestroyRenderedText(world, previousString);
     }
 
-    return RenderText(text, fontName, size, position, color);
+    return RenderText(world, text, fontName, size, position, color);
 }
 
 ///-----------------------------------------------------------------------------------------------
 
 void DestroyRenderedText
 (
+    ecs::World& world,
     const ecs::EntityId textStringEntityId
 )
 {
-    auto& world = ecs::World::GetInstance();
     auto& textStringComponent = world.GetComponent<TextStringComponent>(textStringEntityId);
 
     for (const auto& characterEntity : textStringComponent.mTextCharacterEntities)
@@ -213,12 +241,12 @@ void DestroyRenderedText
 
 void MoveText
 (
+    ecs::World& world,
     const ecs::EntityId textStringEntityId,
     const float dx /* 0.0f */,
     const float dy /* 0.0f */
 )
 {
-    auto& world = ecs::World::GetInstance();
     auto& textStringComponent = world.GetComponent<TextStringComponent>(textStringEntityId);
     
     for (const auto& characterEntity : textStringComponent.mTextCharacterEntities)
@@ -231,11 +259,11 @@ void MoveText
 
 void SetTextPosition
 (
+    ecs::World& world,
     const ecs::EntityId textStringEntityId,
     const glm::vec3& position
 )
 {
-    auto& world = ecs::World::GetInstance();
     auto& textStringComponent = world.GetComponent<TextStringComponent>(textStringEntityId);
 
     auto positionCounter = position;
@@ -252,11 +280,11 @@ void SetTextPosition
 
 bool IsTextStringTheSameAsText
 (
+    ecs::World& world,
     const ecs::EntityId textStringEntityId,
     const std::string& textToTest
 )
 {
-    auto& world = ecs::World::GetInstance();
     auto& textStringComponent = world.GetComponent<TextStringComponent>(textStringEntityId);
 
     if (textStringComponent.mTextCharacterEntities.size() != textToTest.size())
@@ -28,11 +28,13 @@ namespace rendering
 ///
 /// This function assumes that a font texture atlas (res/textures/atlases) and a font data file
 /// (under res/data/font_maps) exist with the same name as the one passed in the function.
+/// @param[in] world the world to store the loaded font in.
 /// @param[in] fontName the name of the font to load.
 /// @param[in] fontAtlasCols the number of columns in the font atlas texture.
 /// @param[in] fontAtlasRows the number of rows in the font atlas texture.
 void LoadFont
 (
+    ecs::World& world,
     const StringId& fontName, 
     const int fontAtlasCols, 
     const int fontAtlasRows
@@ -41,6 +43,7 @@ void LoadFont
 ///------------------------------------------------------------------------------------------------
 /// Renders a single character with the given font. 
 ///
+/// @param[in] world the world to create the character entity in.
 /// @param[in] character the character to render.
 /// @param[in] fontName the name of the font to use in rendering.
 /// @param[in] size the size of character.
@@ -49,6 +52,7 @@ void LoadFont
 /// @returns the id of an entity holding the renderable and transform components of the character.
 ecs::EntityId RenderCharacter
 (
+    ecs::World& world,
     const char character,
     const StringId& fontName,
     const float size,
@@ -59,6 +63,7 @@ ecs::EntityId RenderCharacter
 ///------------------------------------------------------------------------------------------------
 /// Renders a text string with the given font. 
 ///
+/// @param[in] world the world to create the text entities in.
 /// @param[in] text the text to render.
 /// @param[in] fontName the name of the font to use in the text rendering.
 /// @param[in] size the size of the rendered text's individual glyphs.
@@ -67,6 +72,7 @@ ecs::EntityId RenderCharacter
 /// @returns the id of an entity holding the root TextStringComponent which contains all the character entities of the input string.
 ecs::EntityId RenderText
 (
+    ecs::World& world,
     const std::string& text,
     const StringId& fontName,
     const float size,
@@ -78,16 +84,18 @@ ecs::EntityId RenderText
 /// Renders a text string with the given font if the text is different from the previous entity's text. 
 /// 
 /// In case of inequality the old entity will be destroyed.
+/// @param[in] world the world to create the text entities in.
 /// @param[in] text the text to render.
-/// @param[in] previousString the entity hodling a TextStringComponent that the first argument will be compared against.
+/// @param[in] previousString the entity hodling a TextStringComponent that the text will be compared against.
 /// @param[in] fontName the name of the font to use in the text rendering.
 /// @param[in] size the size of the rendered text's individual glyphs.
 /// @param[in] position the position to render the string at.
 /// @param[in] color (optional) specifies the custom color of the rendered string.
 /// @returns the id of an entity holding the root TextStringComponent which contains all 
-/// the character entities of the input string (will be the second argument in case of equality).
+/// the character entities of the input string (will be the previous string entity in case of equality).
 ecs::EntityId RenderTextIfDifferentToPreviousString
 (
+    ecs::World& world,
     const std::string& text,
     const ecs::EntityId previousString,
     const StringId& fontName,
@@ -99,11 +107,13 @@ ecs::EntityId RenderTextIfDifferentToPreviousString
 ///------------------------------------------------------------------------------------------------
 /// Moves a text string by a certain displacement.
 ///
+/// @param[in] world the world to look the text up in.
 /// @param[in] textStringEntityId the id of the entity holding the root TextStringComponent of the text to be moved.
 /// @param[in] dx the horizontal displacement
 /// @param[in] dy the vertical displacement
 void MoveText
 (
+    ecs::World& world,
     const ecs::EntityId textStringEntityId,
     const float dx = 0.0f,
     const float dy = 0.0f
@@ -112,10 +122,12 @@ void MoveText
 ///------------------------------------------------------------------------------------------------
 /// Sets the position of a text string.
 ///
+/// @param[in] world the world to look the text up in.
 /// @param[in] textStringEntityId the id of the entity holding the root TextStringComponent of the text to be moved.
 /// @param[in] position the target position of the text
 void SetTextPosition
 (
+    ecs::World& world,
     const ecs::EntityId textStringEntityId,
     const glm::vec3& position
 );
@@ -123,21 +135,25 @@ void SetTextPosition
 ///------------------------------------------------------------------------------------------------
 /// Clears a text string. 
 ///
+/// @param[in] world the world to destroy the text entities in.
 /// @param[in] textStringEntityId the id of the entity holding the root TextStringComponent of the text to be cleared.
 void DestroyRenderedText
 (
+    ecs::World& world,
     const ecs::EntityId textStringEntityId
 );
 
 ///------------------------------------------------------------------------------------------------
-/// Checks whether the TextStringComponent of the entity passed in represents the same string as the second argument. 
+/// Checks whether the TextStringComponent of the entity passed in represents the same string as the text to test. 
 ///
+/// @param[in] world the world to look the text up in.
 /// @param[in] textStringEntityId the id of the entity holding the root TextStringComponent of the text to be checked.
 /// @param[in] textToTest the string to test against.
-/// @returns whether or not the individual characters of the TextStringComponent held by the first argument represents 
-/// the same string as the second argument.
+/// @returns whether or not the individual characters of the TextStringComponent held by the given entity represent 
+/// the same string as the text to test.
 bool IsTextStringTheSameAsText
 (
+    ecs::World& world,
     const ecs::EntityId textStringEntityId,
     const std::string& textToTest
 );
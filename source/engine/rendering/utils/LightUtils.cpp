@@ -22,11 +22,12 @@ namespace rendering
 
 void AddLightSource
 (
+    ecs::World& world,
     const glm::vec3& lightPosition,
     const float lightPower
 )
 {
-    auto& lightStoreComponent = ecs::World::GetInstance().GetSingletonComponent<LightStoreSingletonComponent>();
+    auto& lightStoreComponent = world.GetSingletonComponent<LightStoreSingletonComponent>();
     lightStoreComponent.mLightPositions.emplace_back(lightPosition);
     lightStoreComponent.mLightPowers.emplace_back(lightPower);
 }
@@ -10,6 +10,7 @@
 
 ///------------------------------------------------------------------------------------------------
 
+#include "../../ECS.h"
 #include "../../common/utils/MathUtils.h"
 
 ///------------------------------------------------------------------------------------------------
@@ -25,10 +26,12 @@ namespace rendering
 ///------------------------------------------------------------------------------------------------
 /// Adds a light source to the world.
 ///
+/// @param[in] world the world to add the light source to.
 /// @param[in] lightPosition the position of the light
 /// @param[in] lightPower the power of the light
 void AddLightSource
 (
+    ecs::World& world,
     const glm::vec3& lightPosition,
     const float lightPower
 );
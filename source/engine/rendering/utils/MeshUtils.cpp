@@ -51,6 +51,7 @@ static std::string CreateTexCoordInjectedModelPath
 
 ecs::EntityId LoadAndCreateModelByName
 (
+    ecs::World& world,
     const std::string& modelName,    
     const glm::vec3& initialPosition /* glm::vec3(0.0f, 0.0f, 0.0f) */,
     const glm::vec3& initialRotation /* glm::vec3(0.0f, 0.0f, 0.0f) */,
@@ -58,32 +59,29 @@ ecs::EntityId LoadAndCreateModelByName
     const StringId entityName /* StringId() */
 )
 {
-    auto& world = ecs::World::GetInstance();
     const auto modelEntity = world.CreateEntity();
 
-    auto transformComponent = std::make_unique<TransformComponent>();
-    transformComponent->mPosition = initialPosition;
-    transformComponent->mRotation = initialRotation;
-    transformComponent->mScale = initialScale;
+    // Components are constructed in place, and each one is fully set up before the next is added
+    auto& renderableComponent = world.AddComponent<RenderableComponent>(modelEntity);
+    renderableComponent.mShaderNameId = DEFAULT_MODEL_SHADER;
 
-    auto renderableComponent = std::make_unique<RenderableComponent>();        
-    renderableComponent->mShaderNameId = DEFAULT_MODEL_SHADER;
-
-    renderableComponent->mMeshResourceId =     
+    renderableComponent.mMeshResourceId =     
         resources::ResourceLoadingService::GetInstance().
         LoadResource(resources::ResourceLoadingService::RES_MODELS_ROOT + modelName + ".obj");
         
-    renderableComponent->mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource
+    renderableComponent.mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource
     (
         resources::ResourceLoadingService::RES_TEXTURES_ROOT + modelName + ".png"
     );
     
-    world.AddComponent<RenderableComponent>(modelEntity, std::move(renderableComponent));
-    world.AddComponent<TransformComponent>(modelEntity, std::move(transformComponent));
+    auto& transformComponent = world.AddComponent<TransformComponent>(modelEntity);
+    transformComponent.mPosition = initialPosition;
+    transformComponent.mRotation = initialRotation;
+    transformComponent.mScale = initialScale;
 
     if (entityName != StringId())
     {
-        world.AddComponent<NameComponent>(modelEntity, std::make_unique<NameComponent>(entityName));
+        world.AddComponent<NameComponent>(modelEntity, entityName);
     }
 
     return modelEntity;
@@ -93,6 +91,7 @@ ecs::EntityId LoadAndCreateModelByName
 
 ecs::EntityId LoadAndCreateGuiSprite
 (
+    ecs::World& world,
     const std::string& modelName,
     const std::string& textureName,
     const StringId shaderName,    
@@ -100,30 +99,26 @@ ecs::EntityId LoadAndCreateGuiSprite
     const StringId entityName /* StringId() */
 )
 {
-    auto& world = ecs::World::GetInstance();
     const auto modelEntity = world.CreateEntity();
 
-    auto transformComponent = std::make_unique<TransformComponent>();
-    transformComponent->mPosition = initialPosition;
-
-    auto renderableComponent = std::make_unique<RenderableComponent>();    
-    renderableComponent->mShaderNameId = shaderName;
-    renderableComponent->mIsGuiComponent = true;
-    renderableComponent->mMeshResourceId =     
+    auto& renderableComponent = world.AddComponent<RenderableComponent>(modelEntity);
+    renderableComponent.mShaderNameId = shaderName;
+    renderableComponent.mIsGuiComponent = true;
+    renderableComponent.mMeshResourceId =     
         resources::ResourceLoadingService::GetInstance().
         LoadResource(resources::ResourceLoadingService::RES_MODELS_ROOT + modelName + ".obj");
 
-    renderableComponent->mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource
+    renderableComponent.mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource
     (
         resources::ResourceLoadingService::RES_TEXTURES_ROOT + textureName + ".png"
     );
 
-    world.AddComponent<RenderableComponent>(modelEntity, std::move(renderableComponent));
-    world.AddComponent<TransformComponent>(modelEntity, std::move(transformComponent));
+    auto& transformComponent = world.AddComponent<TransformComponent>(modelEntity);
+    transformComponent.mPosition = initialPosition;
 
     if (entityName != StringId())
     {
-        world.AddComponent<NameComponent>(modelEntity, std::make_unique<NameComponent>(entityName));
+        world.AddComponent<NameComponent>(modelEntity, entityName);
     }
 
     return modelEntity;
@@ -30,13 +30,14 @@ namespace rendering
 ///
 /// Note: this helper function assumes that the model name and texture name are the 
 /// same in their respective resource folders.
+/// @param[in] world the world to create the entity in.
 /// @param[in] modelName the model with the given name to look for in the resource models folder.
-/// @param[in] world the singular world of the ECS state.
 /// @param[in] initialPosition (optional) an initial position for the loaded model.
 /// @param[in] entityName (optional) a string to name the entity with.
 /// @returns the entity id of the loaded entity.
 ecs::EntityId LoadAndCreateModelByName
 (
+    ecs::World& world,
     const std::string& modelName,    
     const glm::vec3& initialPosition = glm::vec3(0.0f, 0.0f, 0.0f),
     const glm::vec3& initialRotation = glm::vec3(0.0f, 0.0f, 0.0f),
@@ -47,15 +48,16 @@ ecs::EntityId LoadAndCreateModelByName
 ///------------------------------------------------------------------------------------------------
 /// Loads and creates and entity holding the loaded Gui sprite model based on the model and texture names supplied.
 ///
+/// @param[in] world the world to create the entity in.
 /// @param[in] modelName the model with the given name to look for in the resource models folder.
 /// @param[in] textureName the texture with the given name to look for in the resource models folder.
 /// @param[in] shaderName the shader with this name will be attached to the model.
-/// @param[in] world the singular world of the ECS state.
 /// @param[in] initialPosition (optional) an initial position for the loaded model.
 /// @param[in] entityName (optional) a string to name the entity with.
 /// @returns the entity id of the loaded entity.
 ecs::EntityId LoadAndCreateGuiSprite
 (
+    ecs::World& world,
     const std::string& modelName,
     const std::string& textureName,
     const StringId shaderName,    
@@ -0,0 +1,223 @@
+///------------------------------------------------------------------------------------------------
+///  RenderQueueUtils.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "RenderQueueUtils.h"
+
+#include <array>
+#include <cstring>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const unsigned int SORT_KEY_PASS_SHIFT = 62U;
+    const unsigned int SHADER_BITS         = 12U;
+    const unsigned int TEXTURE_BITS        = 14U;
+    const unsigned int MESH_BITS           = 12U;
+    const unsigned int DEPTH_BITS          = 24U;
+
+    const unsigned int RADIX_BITS          = 8U;
+    const std::size_t RADIX_BUCKET_COUNT   = 1U << RADIX_BITS;
+    const unsigned int RADIX_PASS_COUNT    = 64U/RADIX_BITS;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::uint64_t FoldId(const std::uint64_t id, const unsigned int bitCount)
+{
+    // Fibonacci hashing spreads ids that only differ in their low bits across the kept top bits
+    return (id * 0x9E3779B97F4A7C15ULL) >> (64U - bitCount);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::uint64_t QuantizeDepth(const float depth)
+{
+    // Maps the float onto an unsigned integer of the same order (negatives flipped entirely,
+    // positives with the sign bit set), and keeps its most significant bits
+    std::uint32_t depthBits = 0U;
+    std::memcpy(&depthBits, &depth, sizeof(depthBits));
+    depthBits = (depthBits & 0x80000000U) != 0U ? ~depthBits : depthBits | 0x80000000U;
+    return depthBits >> (32U - DEPTH_BITS);
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::uint64_t CreateDrawItemSortKey
+(
+    const RenderPass renderPass,
+    const StringId& shaderNameId,
+    const ResourceId textureResourceId,
+    const ResourceId meshResourceId,
+    const float depth
+)
+{
+    const auto passBits    = static_cast<std::uint64_t>(renderPass) << SORT_KEY_PASS_SHIFT;
+    const auto shaderBits  = FoldId(shaderNameId.GetStringId(), SHADER_BITS);
+    const auto textureBits = FoldId(textureResourceId, TEXTURE_BITS);
+    const auto meshBits    = FoldId(meshResourceId, MESH_BITS);
+    const auto depthBits   = QuantizeDepth(depth);
+
+    if (renderPass == RenderPass::OPAQUE_GEOMETRY)
+    {
+        return passBits | shaderBits << (TEXTURE_BITS + MESH_BITS + DEPTH_BITS) | textureBits << (MESH_BITS + DEPTH_BITS) | meshBits << DEPTH_BITS | depthBits;
+    }
+
+    // Back to front, with the state only breaking ties between equally distant items
+    const auto invertedDepthBits = ((1ULL << DEPTH_BITS) - 1U) - depthBits;
+    return passBits | invertedDepthBits << (SHADER_BITS + TEXTURE_BITS + MESH_BITS) | shaderBits << (TEXTURE_BITS + MESH_BITS) | textureBits << MESH_BITS | meshBits;
+}
+
+///------------------------------------------------------------------------------------------------
+
+RenderPass GetDrawItemRenderPass(const std::uint64_t sortKey)
+{
+    return static_cast<RenderPass>(sortKey >> SORT_KEY_PASS_SHIFT);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void SortDrawItems(std::vector<DrawItem>& drawItems, std::vector<DrawItem>& scratchDrawItems)
+{
+    const auto drawItemCount = drawItems.size();
+    scratchDrawItems.resize(drawItemCount);
+
+    // All digit histograms are gathered in a single sweep over the keys
+    std::array<std::array<std::size_t, RADIX_BUCKET_COUNT>, RADIX_PASS_COUNT> digitCounts = {};
+    for (const auto& drawItem: drawItems)
+    {
+        for (auto pass = 0U; pass < RADIX_PASS_COUNT; ++pass)
+        {
+            digitCounts[pass][(drawItem.mSortKey >> (pass * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1U)]++;
+        }
+    }
+
+    for (auto pass = 0U; pass < RADIX_PASS_COUNT; ++pass)
+    {
+        auto& passDigitCounts = digitCounts[pass];
+
+        // A byte that all keys share would leave the order untouched
+        const auto firstDigit = (drawItems.empty() ? 0U : drawItems.front().mSortKey >> (pass * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1U);
+        if (passDigitCounts[firstDigit] == drawItemCount)
+        {
+            continue;
+        }
+
+        // Turn the digit counts into the starting offsets of each bucket
+        auto bucketOffset = std::size_t(0U);
+        for (auto& digitCount: passDigitCounts)
+        {
+            const auto bucketSize = digitCount;
+            digitCount    = bucketOffset;
+            bucketOffset += bucketSize;
+        }
+
+        for (const auto& drawItem: drawItems)
+        {
+            scratchDrawItems[passDigitCounts[(drawItem.mSortKey >> (pass * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1U)]++] = drawItem;
+        }
+
+        drawItems.swap(scratchDrawItems);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void FormDrawBatches
+(
+    const std::vector<DrawItem>& drawItems,
+    const std::size_t minInstancedBatchSize,
+    const std::function<bool(const DrawItem& batchDrawItem, const DrawItem& drawItem)>& canShareInstancedDraw,
+    std::vector<DrawBatch>& drawBatches
+)
+{
+    drawBatches.clear();
+
+    auto batchStartIndex = std::size_t(0U);
+    while (batchStartIndex < drawItems.size())
+    {
+        auto batchEndIndex = batchStartIndex + 1U;
+        while (batchEndIndex < drawItems.size() && canShareInstancedDraw(drawItems[batchStartIndex], drawItems[batchEndIndex]))
+        {
+            ++batchEndIndex;
+        }
+
+        const auto batchSize = batchEndIndex - batchStartIndex;
+        if (batchSize >= minInstancedBatchSize && batchSize > 1U)
+        {
+            drawBatches.push_back(DrawBatch{ static_cast<std::uint32_t>(batchStartIndex), static_cast<std::uint32_t>(batchSize), true });
+        }
+        else
+        {
+            for (auto drawItemIndex = batchStartIndex; drawItemIndex < batchEndIndex; ++drawItemIndex)
+            {
+                drawBatches.push_back(DrawBatch{ static_cast<std::uint32_t>(drawItemIndex), 1U, false });
+            }
+        }
+
+        batchStartIndex = batchEndIndex;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool CanBeInstanced
+(
+    const RenderableComponent& renderableComponent,
+    const InstancedShaderVariantMap& instancedShaderVariantNames
+)
+{
+    // Other than the material, only a custom color can vary per instance
+    const auto* shaderParameters = renderableComponent.mShaderParameters.get();
+    const auto hasOnlyInstanceUniforms =
+        shaderParameters == nullptr ||
+        shaderParameters->GetDescriptors().empty() ||
+        (shaderParameters->GetDescriptors().size() == 1U &&
+         shaderParameters->GetDescriptors().front().mUniformName == CUSTOM_COLOR_UNIFORM_NAME &&
+         shaderParameters->GetDescriptors().front().mType == ShaderParameterType::FLOAT_VEC4 &&
+         shaderParameters->GetDescriptors().front().mElementCount == 1U);
+    
+    return hasOnlyInstanceUniforms && instancedShaderVariantNames.count(renderableComponent.mShaderNameId) != 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool CanShareInstancedDraw
+(
+    const DrawItem& batchDrawItem,
+    const RenderableComponent& batchRenderableComponent,
+    const DrawItem& drawItem,
+    const RenderableComponent& renderableComponent,
+    const InstancedShaderVariantMap& instancedShaderVariantNames
+)
+{
+    return
+        GetDrawItemRenderPass(batchDrawItem.mSortKey) == GetDrawItemRenderPass(drawItem.mSortKey) &&
+        batchRenderableComponent.mShaderNameId == renderableComponent.mShaderNameId &&
+        batchRenderableComponent.mTextureResourceId == renderableComponent.mTextureResourceId &&
+        batchRenderableComponent.mMeshResourceId == renderableComponent.mMeshResourceId &&
+        CanBeInstanced(batchRenderableComponent, instancedShaderVariantNames) &&
+        CanBeInstanced(renderableComponent, instancedShaderVariantNames);
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,195 @@
+///------------------------------------------------------------------------------------------------
+///  RenderQueueUtils.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef RenderQueueUtils_h
+#define RenderQueueUtils_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../components/RenderableComponent.h"
+#include "../../common/utils/MathUtils.h"
+#include "../../common/utils/StringUtils.h"
+
+#include <cstdint>
+#include <functional>
+#include <tsl/robin_map.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    // The only shader uniform that instances can vary, other than the material
+    const StringId CUSTOM_COLOR_UNIFORM_NAME = StringId("custom_color");
+}
+
+///------------------------------------------------------------------------------------------------
+
+using ResourceId = unsigned int;
+
+/// Maps the names of shaders to the names of their instanced variants (<name>_instanced)
+using InstancedShaderVariantMap = tsl::robin_map<StringId, StringId, StringIdHasher>;
+
+///------------------------------------------------------------------------------------------------
+/// The render passes, in the order they are executed. The pass occupies the top bits of each sort
+/// key, so that sorting the render queue also orders it by pass.
+enum class RenderPass : std::uint8_t
+{
+    OPAQUE_GEOMETRY      = 0,
+    TRANSPARENT_GEOMETRY = 1,
+    GUI                  = 2
+};
+
+///------------------------------------------------------------------------------------------------
+/// A single entry of the render queue, i.e. a draw call waiting to be issued.
+struct DrawItem
+{
+    std::uint64_t mSortKey    = 0U;
+    std::uint32_t mEntryIndex = 0U;
+};
+
+///------------------------------------------------------------------------------------------------
+/// A run of consecutive draw items of the (sorted) render queue that is issued as a single draw call.
+struct DrawBatch
+{
+    std::uint32_t mFirstDrawItemIndex = 0U;
+    std::uint32_t mDrawItemCount      = 0U;
+    bool mIsInstanced                 = false;
+};
+
+///------------------------------------------------------------------------------------------------
+/// The per instance attributes of an instanced draw call. Each member occupies consecutive vertex
+/// attribute locations starting from FIRST_INSTANCE_ATTRIBUTE_LOCATION (four for each matrix), in
+/// the order they are declared in.
+struct InstanceData
+{
+    glm::mat4 mWorldMatrix;
+    glm::mat4 mNormalMatrix;
+    glm::vec4 mMaterialAmbient;
+    glm::vec4 mMaterialDiffuse;
+    glm::vec4 mMaterialSpecular;
+    glm::vec4 mMaterialProperties; // x: shininess, y: 1 if affected by light (0 otherwise)
+    glm::vec4 mCustomColor;
+};
+
+///------------------------------------------------------------------------------------------------
+
+/// The first vertex attribute location of the instance data (the preceding ones are taken by the mesh vertices).
+static constexpr unsigned int FIRST_INSTANCE_ATTRIBUTE_LOCATION = 3U;
+
+/// The number of vertex attribute locations the instance data occupies.
+static constexpr unsigned int INSTANCE_ATTRIBUTE_LOCATION_COUNT = sizeof(InstanceData)/sizeof(glm::vec4);
+
+///------------------------------------------------------------------------------------------------
+/// Packs the state of a draw call into a sort key.
+///
+/// Opaque items are keyed as pass | shader | texture | mesh | depth, so that draws sharing GL state
+/// end up adjacent (and, within the same state, front to back to reduce overdraw). Transparent and
+/// GUI items are keyed as pass | depth | shader | texture | mesh with an inverted depth, so that they
+/// are drawn back to front for blending to be correct. Resource ids are folded into the few bits
+/// available to them, so unrelated resources may occasionally share a group, which only costs an
+/// additional bind.
+/// @param[in] renderPass the pass the draw call belongs to.
+/// @param[in] shaderNameId the name of the shader used by the draw call.
+/// @param[in] textureResourceId the resource id of the texture used by the draw call.
+/// @param[in] meshResourceId the resource id of the mesh used by the draw call.
+/// @param[in] depth the distance of the drawn entity from the viewer (greater is further away).
+/// @returns the sort key of the draw call.
+std::uint64_t CreateDrawItemSortKey
+(
+    const RenderPass renderPass,
+    const StringId& shaderNameId,
+    const ResourceId textureResourceId,
+    const ResourceId meshResourceId,
+    const float depth
+);
+
+///------------------------------------------------------------------------------------------------
+/// Extracts the render pass out of a sort key \see CreateDrawItemSortKey()
+///
+/// @param[in] sortKey the sort key of a draw item.
+/// @returns the render pass of the draw item.
+RenderPass GetDrawItemRenderPass(const std::uint64_t sortKey);
+
+///------------------------------------------------------------------------------------------------
+/// Sorts the given draw items in ascending sort key order, using a (stable) LSD radix sort.
+///
+/// Byte positions that all keys share are skipped, so that the typical queue, whose keys mostly
+/// differ in a handful of bytes, only takes a few passes.
+/// @param[in,out] drawItems the draw items to sort.
+/// @param[in,out] scratchDrawItems a buffer the sort alternates with, reused across calls to avoid allocations.
+void SortDrawItems(std::vector<DrawItem>& drawItems, std::vector<DrawItem>& scratchDrawItems);
+
+///------------------------------------------------------------------------------------------------
+/// Splits the sorted draw items into the draw calls to issue, merging runs of consecutive items that
+/// can share an instanced draw call.
+///
+/// Only adjacent items are merged, so the order of the render queue (and hence back to front
+/// blending) is preserved. Runs shorter than the given minimum are issued as individual draw calls.
+/// @param[in] drawItems the sorted draw items.
+/// @param[in] minInstancedBatchSize the minimum number of items worth an instanced draw call.
+/// @param[in] canShareInstancedDraw whether the second item can be drawn as an instance of the first item's batch.
+/// @param[out] drawBatches the resulting draw calls, in the order of the draw items.
+void FormDrawBatches
+(
+    const std::vector<DrawItem>& drawItems,
+    const std::size_t minInstancedBatchSize,
+    const std::function<bool(const DrawItem& batchDrawItem, const DrawItem& drawItem)>& canShareInstancedDraw,
+    std::vector<DrawBatch>& drawBatches
+);
+
+///------------------------------------------------------------------------------------------------
+/// Checks whether the given renderable can be drawn through the instanced variant of its shader, i.e.
+/// whether such a variant exists, and the renderable sets no shader uniforms other than custom_color,
+/// which (like the material) is part of the per instance data.
+/// @param[in] renderableComponent the renderable to check.
+/// @param[in] instancedShaderVariantNames the instanced variants of the loaded shaders.
+/// @returns whether the renderable can be drawn as an instance.
+bool CanBeInstanced
+(
+    const RenderableComponent& renderableComponent,
+    const InstancedShaderVariantMap& instancedShaderVariantNames
+);
+
+///------------------------------------------------------------------------------------------------
+/// Checks whether a draw item can be drawn as an instance of another item's batch, i.e. whether both
+/// are in the same pass, share shader, texture and mesh, and can both be instanced. \see CanBeInstanced()
+///
+/// @param[in] batchDrawItem the first draw item of the batch.
+/// @param[in] batchRenderableComponent the renderable of the batch's first draw item.
+/// @param[in] drawItem the draw item to check.
+/// @param[in] renderableComponent the renderable of the draw item to check.
+/// @param[in] instancedShaderVariantNames the instanced variants of the loaded shaders.
+/// @returns whether the draw item can join the batch.
+bool CanShareInstancedDraw
+(
+    const DrawItem& batchDrawItem,
+    const RenderableComponent& batchRenderableComponent,
+    const DrawItem& drawItem,
+    const RenderableComponent& renderableComponent,
+    const InstancedShaderVariantMap& instancedShaderVariantNames
+);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* RenderQueueUtils_h */
@@ -0,0 +1,198 @@
+///------------------------------------------------------------------------------------------------
+///  ShaderParameterBlock.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "ShaderParameterBlock.h"
+
+#include <algorithm> // lower_bound
+#include <cassert>
+#include <cstring>   // memcpy
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<ShaderParameterDescriptor>::const_iterator FindDescriptor(const std::vector<ShaderParameterDescriptor>& descriptors, const StringId& uniformName)
+{
+    return std::lower_bound(descriptors.cbegin(), descriptors.cend(), uniformName, [](const ShaderParameterDescriptor& descriptor, const StringId& name)
+    {
+        return descriptor.mUniformName < name;
+    });
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::size_t GetElementByteCount(const ShaderParameterType type)
+{
+    switch (type)
+    {
+        case ShaderParameterType::MATRIX4:    return sizeof(glm::mat4);
+        case ShaderParameterType::FLOAT_VEC4: return sizeof(glm::vec4);
+        case ShaderParameterType::FLOAT_VEC3: return sizeof(glm::vec3);
+        case ShaderParameterType::FLOAT:      return sizeof(float);
+        case ShaderParameterType::INT:        return sizeof(int);
+    }
+    
+    return 0U;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderParameterBlock::SetMatrix4(const StringId& uniformName, const glm::mat4& matrix)
+{
+    SetParameter(uniformName, ShaderParameterType::MATRIX4, 1U, &matrix, sizeof(matrix));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderParameterBlock::SetFloatVec4(const StringId& uniformName, const glm::vec4& vec)
+{
+    SetParameter(uniformName, ShaderParameterType::FLOAT_VEC4, 1U, &vec, sizeof(vec));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderParameterBlock::SetFloatVec3(const StringId& uniformName, const glm::vec3& vec)
+{
+    SetParameter(uniformName, ShaderParameterType::FLOAT_VEC3, 1U, &vec, sizeof(vec));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderParameterBlock::SetFloat(const StringId& uniformName, const float value)
+{
+    SetParameter(uniformName, ShaderParameterType::FLOAT, 1U, &value, sizeof(value));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderParameterBlock::SetInt(const StringId& uniformName, const int value)
+{
+    SetParameter(uniformName, ShaderParameterType::INT, 1U, &value, sizeof(value));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderParameterBlock::SetFloatVec4Array(const StringId& uniformName, const std::vector<glm::vec4>& values)
+{
+    SetParameter(uniformName, ShaderParameterType::FLOAT_VEC4, values.size(), values.data(), values.size() * sizeof(glm::vec4));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderParameterBlock::SetFloatVec3Array(const StringId& uniformName, const std::vector<glm::vec3>& values)
+{
+    SetParameter(uniformName, ShaderParameterType::FLOAT_VEC3, values.size(), values.data(), values.size() * sizeof(glm::vec3));
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool ShaderParameterBlock::GetFloatVec4(const StringId& uniformName, glm::vec4& outVec) const
+{
+    const auto descriptorIter = FindDescriptor(mDescriptors, uniformName);
+    if (descriptorIter == mDescriptors.cend() || descriptorIter->mUniformName != uniformName || descriptorIter->mType != ShaderParameterType::FLOAT_VEC4 || descriptorIter->mElementCount != 1U)
+    {
+        return false;
+    }
+
+    std::memcpy(&outVec, GetParameterData(*descriptorIter), sizeof(outVec));
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const std::vector<ShaderParameterDescriptor>& ShaderParameterBlock::GetDescriptors() const
+{
+    return mDescriptors;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const void* ShaderParameterBlock::GetParameterData(const ShaderParameterDescriptor& descriptor) const
+{
+    return mData.data() + descriptor.mByteOffset;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::uint32_t ShaderParameterBlock::GetVersion() const
+{
+    return mVersion;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderParameterBlock::SetParameter
+(
+    const StringId& uniformName,
+    const ShaderParameterType type,
+    const std::size_t elementCount,
+    const void* values,
+    const std::size_t byteCount
+)
+{
+    assert(elementCount <= UINT16_MAX && "Too many shader parameter elements");
+    mVersion++;
+
+    auto descriptorIter = mDescriptors.begin() + (FindDescriptor(mDescriptors, uniformName) - mDescriptors.cbegin());
+    const auto isExistingParameter = descriptorIter != mDescriptors.end() && descriptorIter->mUniformName == uniformName;
+    assert((!isExistingParameter || descriptorIter->mType == type) && "Shader parameter set with a different type than its existing one");
+
+    // Overwrite the values in place when the parameter's size has not changed
+    if (isExistingParameter && descriptorIter->mElementCount == elementCount)
+    {
+        if (byteCount > 0U)
+        {
+            std::memcpy(mData.data() + descriptorIter->mByteOffset, values, byteCount);
+        }
+        return;
+    }
+
+    if (isExistingParameter)
+    {
+        // Cut out the parameter's previous values, shifting the ones placed after them down
+        const auto previousByteOffset = descriptorIter->mByteOffset;
+        const auto previousByteCount  = static_cast<std::uint32_t>(descriptorIter->mElementCount * GetElementByteCount(descriptorIter->mType));
+        mData.erase(mData.begin() + previousByteOffset, mData.begin() + previousByteOffset + previousByteCount);
+        
+        for (auto& descriptor: mDescriptors)
+        {
+            if (descriptor.mByteOffset > previousByteOffset)
+            {
+                descriptor.mByteOffset -= previousByteCount;
+            }
+        }
+    }
+    else
+    {
+        descriptorIter = mDescriptors.insert(descriptorIter, ShaderParameterDescriptor());
+        descriptorIter->mUniformName = uniformName;
+    }
+    
+    // The (new or resized) parameter's values are appended at the end of the buffer
+    descriptorIter->mByteOffset   = static_cast<std::uint32_t>(mData.size());
+    descriptorIter->mElementCount = static_cast<std::uint16_t>(elementCount);
+    descriptorIter->mType         = type;
+    
+    const auto* valueBytes = static_cast<const std::uint8_t*>(values);
+    mData.insert(mData.end(), valueBytes, valueBytes + byteCount);
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
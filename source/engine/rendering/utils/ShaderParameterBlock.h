@@ -0,0 +1,117 @@
+///------------------------------------------------------------------------------------------------
+///  ShaderParameterBlock.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef ShaderParameterBlock_h
+#define ShaderParameterBlock_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../../common/utils/MathUtils.h"
+#include "../../common/utils/StringUtils.h"
+
+#include <cstdint>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+/// The value types a shader parameter can hold.
+enum class ShaderParameterType : std::uint8_t
+{
+    MATRIX4,
+    FLOAT_VEC4,
+    FLOAT_VEC3,
+    FLOAT,
+    INT
+};
+
+///------------------------------------------------------------------------------------------------
+/// Describes where a parameter's values live in the data of a ShaderParameterBlock.
+struct ShaderParameterDescriptor
+{
+    StringId mUniformName;
+    std::uint32_t mByteOffset      = 0U;
+    std::uint16_t mElementCount    = 0U; // 1 for non array parameters
+    ShaderParameterType mType      = ShaderParameterType::FLOAT;
+};
+
+///------------------------------------------------------------------------------------------------
+/// The custom shader parameters (uniform values beyond the ones the engine sets itself) of a
+/// material, stored as a single contiguous buffer of tightly packed values plus a small descriptor
+/// table sorted by uniform name.
+///
+/// Each parameter's values are laid out exactly as the glUniform*v family expects them, so that a
+/// parameter is uploaded straight out of the buffer in a single call. Blocks are meant to be shared
+/// (through RenderableComponent::mShaderParameters) by all entities using the same material, and
+/// the buffer only grows when a new parameter is added, so updating existing values never allocates.
+class ShaderParameterBlock final
+{
+public:
+    // Each setter overwrites the parameter's values in place, or appends the parameter if the block
+    // does not hold it yet (or holds it with a different element count)
+    void SetMatrix4(const StringId& uniformName, const glm::mat4& matrix);
+    void SetFloatVec4(const StringId& uniformName, const glm::vec4& vec);
+    void SetFloatVec3(const StringId& uniformName, const glm::vec3& vec);
+    void SetFloat(const StringId& uniformName, const float value);
+    void SetInt(const StringId& uniformName, const int value);
+    void SetFloatVec4Array(const StringId& uniformName, const std::vector<glm::vec4>& values);
+    void SetFloatVec3Array(const StringId& uniformName, const std::vector<glm::vec3>& values);
+
+    ///--------------------------------------------------------------------------------------------
+    /// Retrieves the value of a non array vec4 parameter.
+    ///
+    /// @param[in] uniformName the uniform name of the parameter.
+    /// @param[out] outVec the value of the parameter, left untouched if the block does not hold it.
+    /// @returns whether the block holds a vec4 parameter with the given name.
+    bool GetFloatVec4(const StringId& uniformName, glm::vec4& outVec) const;
+
+    ///--------------------------------------------------------------------------------------------
+    /// Returns the descriptors of all parameters in the block, sorted by uniform name.
+    const std::vector<ShaderParameterDescriptor>& GetDescriptors() const;
+
+    ///--------------------------------------------------------------------------------------------
+    /// Returns the start of the given parameter's values.
+    const void* GetParameterData(const ShaderParameterDescriptor& descriptor) const;
+
+    ///--------------------------------------------------------------------------------------------
+    /// Returns a counter incremented on every modification of the block, which allows the renderer
+    /// to skip re-applying a block that has not changed since it was last applied.
+    std::uint32_t GetVersion() const;
+
+private:
+    void SetParameter
+    (
+        const StringId& uniformName,
+        const ShaderParameterType type,
+        const std::size_t elementCount,
+        const void* values,
+        const std::size_t byteCount
+    );
+
+private:
+    std::vector<ShaderParameterDescriptor> mDescriptors;
+    std::vector<std::uint8_t> mData;
+    std::uint32_t mVersion = 0U;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* ShaderParameterBlock_h */
@@ -0,0 +1,72 @@
+///------------------------------------------------------------------------------------------------
+///  UniformBlockUtils.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "UniformBlockUtils.h"
+#include "../opengl/Context.h"
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const char* FRAME_UNIFORM_BLOCK_NAME    = "FrameData";
+    const char* MATERIAL_UNIFORM_BLOCK_NAME = "MaterialData";
+}
+
+///------------------------------------------------------------------------------------------------
+
+void BindUniformBlocksToProgram(const GLuint programId)
+{
+    const auto frameUniformBlockIndex = GL_NO_CHECK(glGetUniformBlockIndex(programId, FRAME_UNIFORM_BLOCK_NAME));
+    if (frameUniformBlockIndex != GL_INVALID_INDEX)
+    {
+        GL_CHECK(glUniformBlockBinding(programId, frameUniformBlockIndex, FRAME_UNIFORM_BLOCK_BINDING));
+    }
+
+    const auto materialUniformBlockIndex = GL_NO_CHECK(glGetUniformBlockIndex(programId, MATERIAL_UNIFORM_BLOCK_NAME));
+    if (materialUniformBlockIndex != GL_INVALID_INDEX)
+    {
+        GL_CHECK(glUniformBlockBinding(programId, materialUniformBlockIndex, MATERIAL_UNIFORM_BLOCK_BINDING));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+GLuint CreateUniformBuffer(const GLuint bindingPoint, const std::size_t byteCount)
+{
+    GLuint uniformBufferObject = 0;
+    GL_CHECK(glGenBuffers(1, &uniformBufferObject));
+    GL_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, uniformBufferObject));
+    GL_CHECK(glBufferData(GL_UNIFORM_BUFFER, byteCount, nullptr, GL_DYNAMIC_DRAW));
+    GL_CHECK(glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, uniformBufferObject));
+    return uniformBufferObject;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void UploadUniformBuffer(const GLuint uniformBufferObject, const void* data, const std::size_t byteCount)
+{
+    GL_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, uniformBufferObject));
+    GL_CHECK(glBufferSubData(GL_UNIFORM_BUFFER, 0, byteCount, data));
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,100 @@
+///------------------------------------------------------------------------------------------------
+///  UniformBlockUtils.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef UniformBlockUtils_h
+#define UniformBlockUtils_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../../common/utils/MathUtils.h"
+
+#include <cstddef>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///------------------------------------------------------------------------------------------------
+
+using GLuint = unsigned int;
+
+///------------------------------------------------------------------------------------------------
+
+/// The maximum number of lights the shaders take into account.
+static constexpr std::size_t MAX_LIGHT_COUNT = 32U;
+
+/// The binding points of the uniform blocks shared by all shaders.
+static constexpr GLuint FRAME_UNIFORM_BLOCK_BINDING    = 0U;
+static constexpr GLuint MATERIAL_UNIFORM_BLOCK_BINDING = 1U;
+
+///------------------------------------------------------------------------------------------------
+/// The data that stays constant throughout a frame, uploaded once per frame. Mirrors the std140
+/// layout of the FrameData uniform block in the shaders.
+struct FrameUniformBlock
+{
+    glm::mat4 mViewMatrix;
+    glm::mat4 mProjectionMatrix;
+    glm::vec4 mEyePosition;
+    glm::vec4 mLights[MAX_LIGHT_COUNT]; // xyz: position, w: power
+};
+
+///------------------------------------------------------------------------------------------------
+/// The material of the entity being drawn, only uploaded when it differs from that of the previous
+/// draw call. Mirrors the std140 layout of the MaterialData uniform block in the shaders.
+struct MaterialUniformBlock
+{
+    glm::vec4 mAmbient;
+    glm::vec4 mDiffuse;
+    glm::vec4 mSpecular;
+    float mShininess;
+    int mIsAffectedByLight;
+    float mPadding[2];
+};
+
+///------------------------------------------------------------------------------------------------
+
+static_assert(sizeof(FrameUniformBlock) == 2 * 64 + 16 + MAX_LIGHT_COUNT * 16, "FrameUniformBlock does not match the std140 layout of FrameData");
+static_assert(sizeof(MaterialUniformBlock) == 4 * 16, "MaterialUniformBlock does not match the std140 layout of MaterialData");
+
+///------------------------------------------------------------------------------------------------
+/// Binds the FrameData and MaterialData uniform blocks of the given program (whichever of them it
+/// declares) to their binding points.
+///
+/// @param[in] programId the id of the linked shader program.
+void BindUniformBlocksToProgram(const GLuint programId);
+
+///------------------------------------------------------------------------------------------------
+/// Creates a uniform buffer of the given size and attaches it to the given binding point.
+///
+/// @param[in] bindingPoint the binding point to attach the buffer to.
+/// @param[in] byteCount the size of the buffer in bytes.
+/// @returns the id of the created buffer.
+GLuint CreateUniformBuffer(const GLuint bindingPoint, const std::size_t byteCount);
+
+///------------------------------------------------------------------------------------------------
+/// Overwrites the contents of the given uniform buffer.
+///
+/// @param[in] uniformBufferObject the id of the uniform buffer.
+/// @param[in] data the new contents of the buffer.
+/// @param[in] byteCount the size of the new contents in bytes.
+void UploadUniformBuffer(const GLuint uniformBufferObject, const void* data, const std::size_t byteCount);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* UniformBlockUtils_h */
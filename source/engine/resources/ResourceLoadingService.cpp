@@ -154,13 +154,20 @@ void ResourceLoadingService::UnloadResource(const std::string& resourcePath)
 {
     const auto adjustedPath = AdjustResourcePath(resourcePath);
     const auto resourceId = GetStringHash(adjustedPath);
-    mResourceMap.erase(resourceId);
+    UnloadResource(resourceId);
 }
 
 ///------------------------------------------------------------------------------------------------
 
 void ResourceLoadingService::UnloadResource(const ResourceId resourceId)
 {
+    auto resourceByteCountIter = mResourceByteCounts.find(resourceId);
+    if (resourceByteCountIter != mResourceByteCounts.end())
+    {
+        mLoadedResourceByteCount -= resourceByteCountIter->second;
+        mResourceByteCounts.erase(resourceByteCountIter);
+    }
+    
     mResourceMap.erase(resourceId);
 }
 
@@ -199,6 +206,12 @@ void ResourceLoadingService::LoadResourceInternal(const std::string& resourcePat
     
     assert(loadedResource != nullptr && "No loader was able to load resource");
     mResourceMap[resourceId] = std::move(loadedResource);
+    
+    // Track the on disk size of the resource file, for telemetry
+    std::ifstream resourceFile(RES_ROOT + resourcePath, std::ios::binary | std::ios::ate);
+    const auto resourceByteCount = resourceFile ? static_cast<std::size_t>(resourceFile.tellg()) : 0U;
+    mResourceByteCounts[resourceId] = resourceByteCount;
+    mLoadedResourceByteCount += resourceByteCount;
 }
 
 ///------------------------------------------------------------------------------------------------
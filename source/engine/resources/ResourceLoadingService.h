@@ -132,6 +132,14 @@ public:
     /// @param[in] resourceId the id of the resource to unload.    
     void UnloadResource(const ResourceId resourceId);
     
+    /// Gets the combined on disk size of the files of all currently loaded resources.
+    ///
+    /// @returns the number of bytes of all loaded resource files.
+    inline std::size_t GetLoadedResourceByteCount() const
+    {
+        return mLoadedResourceByteCount;
+    }
+    
     /// Gets the concrete type of the resource that was loaded based on the given path.
     ///    
     /// Both full paths, relative paths including the Resource Root, and relative
@@ -174,6 +182,8 @@ private:
     tsl::robin_map<ResourceId, std::unique_ptr<IResource>, ResourceIdHasher> mResourceMap;
     tsl::robin_map<StringId, IResourceLoader*, StringIdHasher> mResourceExtensionsToLoadersMap;
     std::vector<std::unique_ptr<IResourceLoader>> mResourceLoaders;
+    tsl::robin_map<ResourceId, std::size_t, ResourceIdHasher> mResourceByteCounts;
+    std::size_t mLoadedResourceByteCount = 0U;
 };
 
 ///------------------------------------------------------------------------------------------------
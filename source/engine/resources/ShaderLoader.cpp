@@ -11,6 +11,7 @@
 #include "../common/utils/StringUtils.h"
 #include "../resources/ShaderResource.h"
 #include "../rendering/opengl/Context.h"
+#include "../rendering/utils/UniformBlockUtils.h"
 
 #include <fstream>   // ifstream
 #include <streambuf> // istreambuf_iterator
@@ -32,7 +33,7 @@ const std::string ShaderLoader::FRAGMENT_SHADER_FILE_EXTENSION = ".fs";
 
 ///------------------------------------------------------------------------------------------------
 
-static void ExtractUniformFromLine(const std::string& line, const GLuint programId, tsl::robin_map<StringId, GLuint, StringIdHasher>& outUniformNamesToLocations);
+static void ExtractUniformFromLine(const std::string& line, const GLuint programId, tsl::robin_map<StringId, UniformLocation, StringIdHasher>& outUniformNamesToLocations);
 
 ///------------------------------------------------------------------------------------------------
 
@@ -112,6 +113,9 @@ std::unique_ptr<IResource> ShaderLoader::VCreateAndLoadResource(const std::strin
     }
 #endif
     
+    // Uniform blocks are shared by all programs, so they are bound to fixed binding points
+    rendering::BindUniformBlocksToProgram(programId);
+    
     GL_CHECK(glValidateProgram(programId));
     
 #ifndef _WIN32
@@ -167,14 +171,14 @@ std::string ShaderLoader::ReadFileContents(const std::string& filePath) const
 
 ///------------------------------------------------------------------------------------------------
 
-tsl::robin_map<StringId, GLuint, StringIdHasher> ShaderLoader::GetUniformNamesToLocationsMap
+tsl::robin_map<StringId, UniformLocation, StringIdHasher> ShaderLoader::GetUniformNamesToLocationsMap
 (
     const GLuint programId,
     const std::string& vertexShaderFileContents,
     const std::string& fragmentShaderFileContents
 ) const
 {
-    tsl::robin_map<StringId, GLuint, StringIdHasher> uniformNamesToLocationsMap;
+    tsl::robin_map<StringId, UniformLocation, StringIdHasher> uniformNamesToLocationsMap;
     
     const auto vertexShaderContentSplitByNewline = StringSplit(vertexShaderFileContents, '\n');
     for (const auto& vertexShaderLine: vertexShaderContentSplitByNewline)
@@ -199,7 +203,7 @@ tsl::robin_map<StringId, GLuint, StringIdHasher> ShaderLoader::GetUniformNamesTo
 
 ///------------------------------------------------------------------------------------------------
 
-void ExtractUniformFromLine(const std::string& line, const GLuint programId, tsl::robin_map<StringId, GLuint, StringIdHasher>& outUniformNamesToLocations)
+void ExtractUniformFromLine(const std::string& line, const GLuint programId, tsl::robin_map<StringId, UniformLocation, StringIdHasher>& outUniformNamesToLocations)
 {
     const auto uniformLineSplitBySpace = StringSplit(line, ' ');
     
@@ -220,25 +224,22 @@ void ExtractUniformFromLine(const std::string& line, const GLuint programId, tsl
             ShowMessageBox(MessageBoxType::ERROR, "Error Extracting Uniform", "Could not parse array element count for uniform: " + uniformName);
         }
         
+        // Arrays are resolved to the location of their first element, the rest following consecutively,
+        // so that they can be set in a single call
         const auto numberOfElements = std::stoi(uniformNameSplitByLeftSquareBracket[1]);
+        const auto uniformLocation = GL_NO_CHECK(glGetUniformLocation(programId, uniformName.c_str()));
+        outUniformNamesToLocations[StringId(uniformName)] = UniformLocation{ uniformLocation, numberOfElements };
         
-        for (int i = 0; i < numberOfElements; ++i)
+        if (uniformLocation == -1)
         {
-            const auto indexedUniformName = uniformName + "[" + std::to_string(i) + "]";
-            const auto uniformLocation = GL_NO_CHECK(glGetUniformLocation(programId, indexedUniformName.c_str()));
-            outUniformNamesToLocations[StringId(indexedUniformName)] = uniformLocation;
-            
-            if (uniformLocation == -1)
-            {
-                Log(LogType::WARNING, "Unused uniform at location -1: %s", indexedUniformName.c_str());
-            }
+            Log(LogType::WARNING, "Unused uniform at location -1: %s", uniformName.c_str());
         }
     }
     // Normal uniform
     else
     {
-        auto uniformLocation = GL_NO_CHECK(glGetUniformLocation(programId, uniformName.c_str()));
-        outUniformNamesToLocations[StringId(uniformName)] = uniformLocation;
+        const auto uniformLocation = GL_NO_CHECK(glGetUniformLocation(programId, uniformName.c_str()));
+        outUniformNamesToLocations[StringId(uniformName)] = UniformLocation{ uniformLocation, 1 };
         
         if (uniformLocation == -1)
         {
@@ -33,6 +33,10 @@ using GLuint = unsigned int;
 
 ///------------------------------------------------------------------------------------------------
 
+struct UniformLocation;
+
+///------------------------------------------------------------------------------------------------
+
 class ShaderLoader final : public IResourceLoader
 {
     friend class ResourceLoadingService;
@@ -48,7 +52,7 @@ private:
     ShaderLoader() = default;
     
     std::string ReadFileContents(const std::string& filePath) const;
-    tsl::robin_map<StringId, GLuint, StringIdHasher> GetUniformNamesToLocationsMap
+    tsl::robin_map<StringId, UniformLocation, StringIdHasher> GetUniformNamesToLocationsMap
     (
         const GLuint programId,
         const std::string& vertexShaderFileContents,
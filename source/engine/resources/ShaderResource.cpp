@@ -8,6 +8,8 @@
 #include "ShaderResource.h"
 #include "../rendering/opengl/Context.h"
 
+#include <algorithm> // min
+
 ///------------------------------------------------------------------------------------------------
 
 namespace genesis
@@ -22,7 +24,7 @@ namespace resources
 
 ShaderResource::ShaderResource
 (
-    const tsl::robin_map<StringId, GLuint, StringIdHasher> uniformNamesToLocations,
+    const tsl::robin_map<StringId, UniformLocation, StringIdHasher> uniformNamesToLocations,
     const GLuint programId
 )
     : mShaderUniformNamesToLocations(uniformNamesToLocations) 
@@ -48,6 +50,94 @@ ShaderResource::ShaderResource(const ShaderResource& rhs)
 
 ///------------------------------------------------------------------------------------------------
 
+void ShaderResource::SetUniform(const UniformHandle<glm::mat4>& handle, const glm::mat4& matrix) const
+{
+    GL_CHECK(glUniformMatrix4fv(handle.mLocation, 1, GL_FALSE, (GLfloat*)&matrix));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderResource::SetUniform(const UniformHandle<glm::vec4>& handle, const glm::vec4& vec) const
+{
+    GL_CHECK(glUniform4f(handle.mLocation, vec.x, vec.y, vec.z, vec.w));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderResource::SetUniform(const UniformHandle<glm::vec3>& handle, const glm::vec3& vec) const
+{
+    GL_CHECK(glUniform3f(handle.mLocation, vec.x, vec.y, vec.z));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderResource::SetUniform(const UniformHandle<float>& handle, const float value) const
+{
+    GL_CHECK(glUniform1f(handle.mLocation, value));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderResource::SetUniform(const UniformHandle<int>& handle, const int value) const
+{
+    GL_CHECK(glUniform1i(handle.mLocation, value));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderResource::SetUniformArray(const UniformHandle<glm::vec4>& handle, const std::vector<glm::vec4>& values) const
+{
+    // Array elements occupy consecutive locations, so the whole array is set in a single call
+    const auto elementCount = std::min(static_cast<GLint>(values.size()), handle.mElementCount);
+    GL_CHECK(glUniform4fv(handle.mLocation, elementCount, (GLfloat*)values.data()));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderResource::SetUniformArray(const UniformHandle<glm::vec3>& handle, const std::vector<glm::vec3>& values) const
+{
+    const auto elementCount = std::min(static_cast<GLint>(values.size()), handle.mElementCount);
+    GL_CHECK(glUniform3fv(handle.mLocation, elementCount, (GLfloat*)values.data()));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderResource::SetUniformArray(const UniformHandle<float>& handle, const std::vector<float>& values) const
+{
+    const auto elementCount = std::min(static_cast<GLint>(values.size()), handle.mElementCount);
+    GL_CHECK(glUniform1fv(handle.mLocation, elementCount, values.data()));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderResource::SetParameters(const rendering::ShaderParameterBlock& parameterBlock) const
+{
+    // Each parameter is set straight out of the block's buffer, whole arrays included
+    for (const auto& descriptor: parameterBlock.GetDescriptors())
+    {
+        const auto uniformLocationIter = mShaderUniformNamesToLocations.find(descriptor.mUniformName);
+        if (uniformLocationIter == mShaderUniformNamesToLocations.end() || uniformLocationIter->second.mLocation == -1)
+        {
+            continue;
+        }
+        
+        const auto location     = uniformLocationIter->second.mLocation;
+        const auto elementCount = std::min(static_cast<GLint>(descriptor.mElementCount), uniformLocationIter->second.mElementCount);
+        const auto* data        = parameterBlock.GetParameterData(descriptor);
+        
+        switch (descriptor.mType)
+        {
+            case rendering::ShaderParameterType::MATRIX4:    GL_CHECK(glUniformMatrix4fv(location, elementCount, GL_FALSE, static_cast<const GLfloat*>(data))); break;
+            case rendering::ShaderParameterType::FLOAT_VEC4: GL_CHECK(glUniform4fv(location, elementCount, static_cast<const GLfloat*>(data))); break;
+            case rendering::ShaderParameterType::FLOAT_VEC3: GL_CHECK(glUniform3fv(location, elementCount, static_cast<const GLfloat*>(data))); break;
+            case rendering::ShaderParameterType::FLOAT:      GL_CHECK(glUniform1fv(location, elementCount, static_cast<const GLfloat*>(data))); break;
+            case rendering::ShaderParameterType::INT:        GL_CHECK(glUniform1iv(location, elementCount, static_cast<const GLint*>(data))); break;
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
 bool ShaderResource::SetMatrix4fv
 (
     const StringId& uniformName, 
@@ -56,9 +146,10 @@ bool ShaderResource::SetMatrix4fv
     const bool transpose /* false */
 ) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto handle = GetUniformHandle<glm::mat4>(uniformName);
+    if (handle.IsValid())
     {
-        GL_CHECK(glUniformMatrix4fv(mShaderUniformNamesToLocations.at(uniformName), count, transpose, (GLfloat*)&matrix));
+        GL_CHECK(glUniformMatrix4fv(handle.mLocation, count, transpose, (GLfloat*)&matrix));
         return true;
     }    
     return false;
@@ -68,41 +159,36 @@ bool ShaderResource::SetMatrix4fv
 
 bool ShaderResource::SetFloatVec4Array(const StringId& uniformName, const std::vector<glm::vec4>& values) const
 {
-    for (auto i = 0U; i < values.size(); ++i)
+    const auto handle = GetUniformHandle<glm::vec4>(uniformName);
+    if (handle.IsValid())
     {
-        auto setUniformResult = SetFloatVec4(StringId(uniformName.GetString() + "[" + std::to_string(i) + "]"), values[i]);
-        if (!setUniformResult)
-        {
-            return false;
-        }
+        SetUniformArray(handle, values);
+        return true;
     }
-    
-    return true;
+    return false;
 }
 
 ///------------------------------------------------------------------------------------------------
 
 bool ShaderResource::SetFloatVec3Array(const StringId& uniformName, const std::vector<glm::vec3>& values) const
 {
-    for (auto i = 0U; i < values.size(); ++i)
+    const auto handle = GetUniformHandle<glm::vec3>(uniformName);
+    if (handle.IsValid())
     {
-        auto setUniformResult = SetFloatVec3(StringId(uniformName.GetString() + "[" + std::to_string(i) + "]"), values[i]);
-        if (!setUniformResult)
-        {
-            return false;
-        }
+        SetUniformArray(handle, values);
+        return true;
     }
-    
-    return true;
+    return false;
 }
 
 ///------------------------------------------------------------------------------------------------
 
 bool ShaderResource::SetFloatVec4(const StringId& uniformName, const glm::vec4& vec) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto handle = GetUniformHandle<glm::vec4>(uniformName);
+    if (handle.IsValid())
     {
-        GL_CHECK(glUniform4f(mShaderUniformNamesToLocations.at(uniformName), vec.x, vec.y, vec.z, vec.w));
+        SetUniform(handle, vec);
         return true;
     }
     return false;
@@ -112,9 +198,10 @@ bool ShaderResource::SetFloatVec4(const StringId& uniformName, const glm::vec4&
 
 bool ShaderResource::SetFloatVec3(const StringId& uniformName, const glm::vec3& vec) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto handle = GetUniformHandle<glm::vec3>(uniformName);
+    if (handle.IsValid())
     {
-        GL_CHECK(glUniform3f(mShaderUniformNamesToLocations.at(uniformName), vec.x, vec.y, vec.z));
+        SetUniform(handle, vec);
         return true;
     }
     return false;
@@ -124,9 +211,10 @@ bool ShaderResource::SetFloatVec3(const StringId& uniformName, const glm::vec3&
 
 bool ShaderResource::SetFloat(const StringId& uniformName, const float value) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto handle = GetUniformHandle<float>(uniformName);
+    if (handle.IsValid())
     {
-        GL_CHECK(glUniform1f(mShaderUniformNamesToLocations.at(uniformName), value));
+        SetUniform(handle, value);
         return true;
     }
     return false;
@@ -136,25 +224,23 @@ bool ShaderResource::SetFloat(const StringId& uniformName, const float value) co
 
 bool ShaderResource::SetFloatArray(const StringId& uniformName, const std::vector<float>& values) const
 {
-    for (auto i = 0U; i < values.size(); ++i)
+    const auto handle = GetUniformHandle<float>(uniformName);
+    if (handle.IsValid())
     {
-        auto setUniformResult = SetFloat(StringId(uniformName.GetString() + "[" + std::to_string(i) + "]"), values[i]);
-        if (!setUniformResult)
-        {
-            return false;
-        }
+        SetUniformArray(handle, values);
+        return true;
     }
-    
-    return true;
+    return false;
 }
 
 ///------------------------------------------------------------------------------------------------
 
 bool ShaderResource::SetInt(const StringId& uniformName, const int value) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto handle = GetUniformHandle<int>(uniformName);
+    if (handle.IsValid())
     {
-        GL_CHECK(glUniform1i(mShaderUniformNamesToLocations.at(uniformName), value));
+        SetUniform(handle, value);
         return true;
     }
     return false;
@@ -169,7 +255,7 @@ GLuint ShaderResource::GetProgramId() const
 
 ///------------------------------------------------------------------------------------------------
 
-const tsl::robin_map<StringId, GLuint, StringIdHasher>& ShaderResource::GetUniformNamesToLocations() const
+const tsl::robin_map<StringId, UniformLocation, StringIdHasher>& ShaderResource::GetUniformNamesToLocations() const
 {
     return mShaderUniformNamesToLocations;
 }
@@ -14,8 +14,10 @@
 #include "../common/utils/MathUtils.h"
 #include "../common/utils/StringUtils.h"
 #include "../rendering/systems/RenderingSystem.h"
+#include "../rendering/utils/ShaderParameterBlock.h"
 
 #include <string>
+#include <vector>
 #include <tsl/robin_map.h>
 
 ///------------------------------------------------------------------------------------------------
@@ -31,6 +33,28 @@ namespace resources
 ///------------------------------------------------------------------------------------------------
 
 using GLuint = unsigned int;
+using GLint  = int;
+
+///------------------------------------------------------------------------------------------------
+/// The location of a uniform in a linked program, resolved once when the shader is loaded.
+struct UniformLocation final
+{
+    GLint mLocation     = -1;
+    GLint mElementCount = 0; // 1 for non array uniforms
+};
+
+///------------------------------------------------------------------------------------------------
+/// A pre-resolved uniform location, typed by the value (or array element) the uniform holds, so that
+/// setting it neither hashes nor looks up its name, and it can only be set with values of that type.
+/// Handles are only meaningful for the shader they were retrieved from.
+template<typename ValueType>
+struct UniformHandle final
+{
+    GLint mLocation     = -1;
+    GLint mElementCount = 0;
+    
+    bool IsValid() const { return mLocation != -1; }
+};
 
 ///------------------------------------------------------------------------------------------------
 
@@ -42,13 +66,35 @@ public:
     ShaderResource() = default;
     ShaderResource
     (
-        const tsl::robin_map<StringId, GLuint, StringIdHasher> uniformNamesToLocations,
+        const tsl::robin_map<StringId, UniformLocation, StringIdHasher> uniformNamesToLocations,
         const GLuint programId
     );
     ShaderResource& operator = (const ShaderResource&);
     ShaderResource(const ShaderResource&);
     
 private:
+    template<typename ValueType>
+    UniformHandle<ValueType> GetUniformHandle(const StringId& uniformName) const
+    {
+        const auto uniformLocationIter = mShaderUniformNamesToLocations.find(uniformName);
+        if (uniformLocationIter == mShaderUniformNamesToLocations.end())
+        {
+            return UniformHandle<ValueType>();
+        }
+        
+        return UniformHandle<ValueType>{ uniformLocationIter->second.mLocation, uniformLocationIter->second.mElementCount };
+    }
+    
+    void SetUniform(const UniformHandle<glm::mat4>& handle, const glm::mat4& matrix) const;
+    void SetUniform(const UniformHandle<glm::vec4>& handle, const glm::vec4& vec) const;
+    void SetUniform(const UniformHandle<glm::vec3>& handle, const glm::vec3& vec) const;
+    void SetUniform(const UniformHandle<float>& handle, const float value) const;
+    void SetUniform(const UniformHandle<int>& handle, const int value) const;
+    void SetUniformArray(const UniformHandle<glm::vec4>& handle, const std::vector<glm::vec4>& values) const;
+    void SetUniformArray(const UniformHandle<glm::vec3>& handle, const std::vector<glm::vec3>& values) const;
+    void SetUniformArray(const UniformHandle<float>& handle, const std::vector<float>& values) const;
+    void SetParameters(const rendering::ShaderParameterBlock& parameterBlock) const;
+    
     bool SetMatrix4fv(const StringId& uniformName, const glm::mat4& matrix, const GLuint count = 1, const bool transpose = false) const;
     bool SetFloatVec4Array(const StringId& uniformName, const std::vector<glm::vec4>& values) const;
     bool SetFloatVec3Array(const StringId& uniformName, const std::vector<glm::vec3>& values) const;
@@ -60,12 +106,12 @@ private:
 
     GLuint GetProgramId() const;    
 
-    const tsl::robin_map<StringId, GLuint, StringIdHasher>& GetUniformNamesToLocations() const;
+    const tsl::robin_map<StringId, UniformLocation, StringIdHasher>& GetUniformNamesToLocations() const;
 
     void CopyConstruction(const ShaderResource&);
     
 private:
-    tsl::robin_map<StringId, GLuint, StringIdHasher> mShaderUniformNamesToLocations;
+    tsl::robin_map<StringId, UniformLocation, StringIdHasher> mShaderUniformNamesToLocations;
     GLuint mProgramId;    
 };
 
@@ -94,7 +94,7 @@ void BindDefaultEngineFunctionsToLua()
         if (stackSize == 1)
         {
             const auto entityId = luaScriptingService.LuaToIntegral(1);
-            const auto& transformComponent = ecs::World::GetInstance().GetComponent<TransformComponent>(entityId);
+            const auto& transformComponent = ecs::World::GetInstance().GetComponent<const TransformComponent>(entityId);
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mPosition.x));
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mPosition.y));
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mPosition.z));
@@ -138,7 +138,7 @@ void BindDefaultEngineFunctionsToLua()
         if (stackSize == 1)
         {
             const auto entityId = luaScriptingService.LuaToIntegral(1);
-            const auto& transformComponent = ecs::World::GetInstance().GetComponent<TransformComponent>(entityId);
+            const auto& transformComponent = ecs::World::GetInstance().GetComponent<const TransformComponent>(entityId);
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mRotation.x));
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mRotation.y));
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mRotation.z));
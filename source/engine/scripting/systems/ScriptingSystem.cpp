@@ -31,8 +31,11 @@ static tsl::robin_map<ScriptType, std::string> sScriptTypeToLuaFuncName =
 
 ///-----------------------------------------------------------------------------------------------
 
-ScriptingSystem::ScriptingSystem()
+ScriptingSystem::ScriptingSystem(ecs::World& world)
+    : BaseSystem(world)
 {
+    // Scripts have unrestricted access to the world through the exported engine functions
+    DeclareStructuralChanges();
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -44,9 +47,12 @@ void ScriptingSystem::VUpdate(const float dt, const std::vector<ecs::EntityId>&
 
     for (const auto& entityId : entitiesToProcess)
     {
-        const auto& scriptComponent = ecs::World::GetInstance().GetComponent<ScriptComponent>(entityId);
+        // Scripts can change the world's structure (and thus relocate components), so no component references are held across them
+        const auto& scriptComponent = GetWorld().GetComponent<const ScriptComponent>(entityId);
+        const auto& scriptFunctionName = sScriptTypeToLuaFuncName.at(scriptComponent.mScriptType);
+        
         LuaScriptingService::GetInstance().RunLuaScript(scriptComponent.mScriptName.GetString());
-        LuaScriptingService::GetInstance().LuaCallGlobalFunction(sScriptTypeToLuaFuncName.at(scriptComponent.mScriptType), 3, entityId, dt, dtAccum);
+        LuaScriptingService::GetInstance().LuaCallGlobalFunction(scriptFunctionName, 3, entityId, dt, dtAccum);
         
     }
 }
@@ -31,7 +31,7 @@ class ScriptComponent;
 class ScriptingSystem final : public ecs::BaseSystem<ScriptComponent>
 {
 public:
-    ScriptingSystem();
+    ScriptingSystem(ecs::World& world);
 
     void VUpdate(const float dt, const std::vector<ecs::EntityId>& entitiesToProcess) const override;
 };
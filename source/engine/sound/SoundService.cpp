@@ -98,8 +98,24 @@ void SoundService::Initialize() const
 
 ///------------------------------------------------------------------------------------------------
 
+void SoundService::InitializeNullBackend()
+{
+    // No audio device is opened, and all playback requests are silently dropped. Audio also stays
+    // disabled for good, which already turns all volume changes into no-ops
+    mIsNullBackend    = true;
+    mAllAudioDisabled = true;
+    Log(LogType::INFO, "Initialized null audio backend");
+}
+
+///------------------------------------------------------------------------------------------------
+
 void SoundService::PlaySfx(const StringId& sfxName, const bool overrideCurrentPlaying /* true */)
 {
+    if (mIsNullBackend)
+    {
+        return;
+    }
+
     auto& resourceLoadingService = resources::ResourceLoadingService::GetInstance();
 
     const auto sfxFilePath = resources::ResourceLoadingService::RES_SFX_ROOT + sfxName.GetString();
@@ -122,7 +138,12 @@ void SoundService::PlaySfx(const StringId& sfxName, const bool overrideCurrentPl
 ///------------------------------------------------------------------------------------------------
 
 void SoundService::PlayMusic(const StringId& musicTrackName, const bool fadeOutEnabled /* true */)
-{    
+{
+    if (mIsNullBackend)
+    {
+        return;
+    }
+
     auto& resourceLoadingService = resources::ResourceLoadingService::GetInstance();
 
     const auto musicFilePath        = resources::ResourceLoadingService::RES_MUSIC_ROOT + musicTrackName.GetString();    
@@ -198,6 +219,11 @@ void SoundService::UnmuteSfx()
 
 void SoundService::ToggleAllAudioOnOff()
 {
+    if (mIsNullBackend)
+    {
+        return;
+    }
+
     mAllAudioDisabled = !mAllAudioDisabled;
     if (!mAllAudioDisabled)
     {
@@ -217,14 +243,14 @@ void SoundService::ToggleAllAudioOnOff()
 
 bool SoundService::IsPlayingMusic() const
 {
-    return Mix_PlayingMusic() != 0;
+    return !mIsNullBackend && Mix_PlayingMusic() != 0;
 }
 
 ///------------------------------------------------------------------------------------------------
 
 bool SoundService::IsPlayingSfx() const
 {
-    return Mix_Playing(SFX_CHANNEL_NUMBER) != 0;
+    return !mIsNullBackend && Mix_Playing(SFX_CHANNEL_NUMBER) != 0;
 }
 
 ///------------------------------------------------------------------------------------------------
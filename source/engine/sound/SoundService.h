@@ -92,11 +92,13 @@ private:
     SoundService() = default;    
     
     void Initialize() const;
+    void InitializeNullBackend();
 
     MusicResourceId mQueuedMusicResourceId;
     int mMusicVolumePriorToMuting = 0;
     int mSfxVolumePriorToMuting = 0;
     bool mAllAudioDisabled = false;
+    bool mIsNullBackend = false;
 
 };
 
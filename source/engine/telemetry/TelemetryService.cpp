@@ -0,0 +1,277 @@
+///------------------------------------------------------------------------------------------------
+///  TelemetryService.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "TelemetryService.h"
+#include "../common/utils/Logging.h"
+
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace telemetry
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+#if defined(_WIN32)
+    using SocketHandle = SOCKET;
+    const SocketHandle INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+#else
+    using SocketHandle = int;
+    const SocketHandle INVALID_SOCKET_HANDLE = -1;
+#endif
+
+#if defined(MSG_NOSIGNAL)
+    const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    const int SEND_FLAGS = 0;
+#endif
+
+    const int CONNECTION_BACKLOG_SIZE      = 4;
+    const long SOCKET_POLL_INTERVAL_MICROS = 100000L;
+    const std::size_t REQUEST_BUFFER_SIZE  = 1024U;
+
+    const std::string RESPONSE_HEADER = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nConnection: close\r\n\r\n";
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void CloseSocket(const SocketHandle socketHandle)
+{
+#if defined(_WIN32)
+    closesocket(socketHandle);
+#else
+    close(socketHandle);
+#endif
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool WaitUntilReadable(const SocketHandle socketHandle)
+{
+    fd_set readSockets;
+    FD_ZERO(&readSockets);
+    FD_SET(socketHandle, &readSockets);
+
+    timeval timeout;
+    timeout.tv_sec  = 0;
+    timeout.tv_usec = SOCKET_POLL_INTERVAL_MICROS;
+
+    return select(static_cast<int>(socketHandle) + 1, &readSockets, nullptr, nullptr, &timeout) > 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::string GetMetricBaseName(const std::string& metricName)
+{
+    return metricName.substr(0, metricName.find('{'));
+}
+
+///------------------------------------------------------------------------------------------------
+
+TelemetryService& TelemetryService::GetInstance()
+{
+    static TelemetryService instance;
+    return instance;
+}
+
+///------------------------------------------------------------------------------------------------
+
+TelemetryService::~TelemetryService()
+{
+    mIsRunning = false;
+    if (mServerThread.joinable())
+    {
+        mServerThread.join();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void TelemetryService::SetGauge(const std::string& metricName, const double value)
+{
+    mStagedGauges[metricName] = value;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void TelemetryService::RecordHistogramSample(const std::string& metricName, const double milliseconds)
+{
+    auto& histogram = mStagedHistograms[metricName];
+    for (auto i = 0U; i < HISTOGRAM_BUCKET_UPPER_BOUNDS_MILLISECONDS.size(); ++i)
+    {
+        if (milliseconds <= HISTOGRAM_BUCKET_UPPER_BOUNDS_MILLISECONDS[i])
+        {
+            histogram.mBucketCounts[i]++;
+            break;
+        }
+    }
+
+    histogram.mSampleCount++;
+    histogram.mSampleSum += milliseconds;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void TelemetryService::Publish()
+{
+    std::lock_guard<std::mutex> lock(mPublishedMetricsMutex);
+    mPublishedGauges     = mStagedGauges;
+    mPublishedHistograms = mStagedHistograms;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void TelemetryService::Initialize(const int port)
+{
+#if defined(_WIN32)
+    WSADATA winsockData;
+    if (WSAStartup(MAKEWORD(2, 2), &winsockData) != 0)
+    {
+        Log(LogType::ERROR, "Could not initialize Winsock, telemetry is disabled");
+        return;
+    }
+#endif
+
+    mIsRunning = true;
+    mServerThread = std::thread([this, port]() { ServeConnections(port); });
+}
+
+///------------------------------------------------------------------------------------------------
+
+void TelemetryService::ServeConnections(const int port)
+{
+    const auto listeningSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listeningSocket == INVALID_SOCKET_HANDLE)
+    {
+        Log(LogType::ERROR, "Could not create the telemetry socket, telemetry is disabled");
+        mIsRunning = false;
+        return;
+    }
+
+    const int reuseAddress = 1;
+    setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuseAddress), sizeof(reuseAddress));
+
+    // Only local tools may scrape the metrics
+    sockaddr_in address = {};
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port        = htons(static_cast<unsigned short>(port));
+
+    if (bind(listeningSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(listeningSocket, CONNECTION_BACKLOG_SIZE) != 0)
+    {
+        Log(LogType::ERROR, "Could not listen on 127.0.0.1:%d, telemetry is disabled", port);
+        CloseSocket(listeningSocket);
+        mIsRunning = false;
+        return;
+    }
+
+    Log(LogType::INFO, "Serving telemetry on 127.0.0.1:%d", port);
+
+    // The listening socket is polled, so that the service can be shut down without any connection arriving
+    while (mIsRunning)
+    {
+        if (!WaitUntilReadable(listeningSocket))
+        {
+            continue;
+        }
+
+        const auto connectionSocket = accept(listeningSocket, nullptr, nullptr);
+        if (connectionSocket == INVALID_SOCKET_HANDLE)
+        {
+            continue;
+        }
+
+        // The request itself is irrelevant, as every connection is answered with all metrics. Clients that
+        // send nothing are answered anyway, rather than being waited on indefinitely.
+        if (WaitUntilReadable(connectionSocket))
+        {
+            char requestBuffer[REQUEST_BUFFER_SIZE];
+            recv(connectionSocket, requestBuffer, sizeof(requestBuffer), 0);
+        }
+
+        const auto response = RESPONSE_HEADER + FormatMetrics();
+        send(connectionSocket, response.c_str(), static_cast<int>(response.size()), SEND_FLAGS);
+        CloseSocket(connectionSocket);
+    }
+
+    CloseSocket(listeningSocket);
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string TelemetryService::FormatMetrics() const
+{
+    std::lock_guard<std::mutex> lock(mPublishedMetricsMutex);
+
+    std::string metrics;
+    char line[256];
+
+    // Metrics are sorted by name, so labelled variants of the same gauge follow its type declaration
+    std::string previousBaseName;
+    for (const auto& gaugeEntry: mPublishedGauges)
+    {
+        const auto baseName = GetMetricBaseName(gaugeEntry.first);
+        if (baseName != previousBaseName)
+        {
+            metrics += "# TYPE " + baseName + " gauge\n";
+            previousBaseName = baseName;
+        }
+
+        std::snprintf(line, sizeof(line), " %.6g\n", gaugeEntry.second);
+        metrics += gaugeEntry.first + line;
+    }
+
+    for (const auto& histogramEntry: mPublishedHistograms)
+    {
+        const auto& histogram = histogramEntry.second;
+        metrics += "# TYPE " + histogramEntry.first + " histogram\n";
+
+        auto cumulativeCount = std::size_t(0U);
+        for (auto i = 0U; i < HISTOGRAM_BUCKET_UPPER_BOUNDS_MILLISECONDS.size(); ++i)
+        {
+            cumulativeCount += histogram.mBucketCounts[i];
+            std::snprintf(line, sizeof(line), "_bucket{le=\"%g\"} %zu\n", HISTOGRAM_BUCKET_UPPER_BOUNDS_MILLISECONDS[i], cumulativeCount);
+            metrics += histogramEntry.first + line;
+        }
+
+        std::snprintf(line, sizeof(line), "_bucket{le=\"+Inf\"} %zu\n", histogram.mSampleCount);
+        metrics += histogramEntry.first + line;
+        std::snprintf(line, sizeof(line), "_sum %.6g\n", histogram.mSampleSum);
+        metrics += histogramEntry.first + line;
+        std::snprintf(line, sizeof(line), "_count %zu\n", histogram.mSampleCount);
+        metrics += histogramEntry.first + line;
+    }
+
+    return metrics;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
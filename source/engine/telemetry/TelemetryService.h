@@ -0,0 +1,118 @@
+///------------------------------------------------------------------------------------------------
+///  TelemetryService.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef TelemetryService_h
+#define TelemetryService_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+class GenesisEngine;
+
+///------------------------------------------------------------------------------------------------
+
+namespace telemetry
+{
+
+///------------------------------------------------------------------------------------------------
+
+/// The upper bounds of the histogram buckets, in milliseconds (a final +Inf bucket is implied).
+static constexpr std::array<double, 10> HISTOGRAM_BUCKET_UPPER_BOUNDS_MILLISECONDS = { 1.0, 2.0, 4.0, 8.0, 16.7, 33.3, 50.0, 100.0, 250.0, 1000.0 };
+
+///------------------------------------------------------------------------------------------------
+/// A service publishing engine metrics (gauges and duration histograms) to external tools.
+///
+/// Metrics are recorded into a staging area without any locking, and only become visible to
+/// scrapers once published (typically once per second). Published metrics are served in the
+/// Prometheus text format, as an HTTP response to any connection on 127.0.0.1:<port>, from a
+/// background thread, so that formatting and socket IO never happen in the frame.
+/// Recording and publishing need to happen on the main thread.
+class TelemetryService final
+{
+    friend class genesis::GenesisEngine;
+
+public:
+    /// The default method of getting a hold of this singleton.
+    ///
+    /// The single instance of this class will be lazily initialized
+    /// the first time it is needed.
+    /// @returns a reference to the single instance of this class.
+    static TelemetryService& GetInstance();
+
+    ~TelemetryService();
+    TelemetryService(const TelemetryService&) = delete;
+    TelemetryService(TelemetryService&&) = delete;
+    const TelemetryService& operator = (const TelemetryService&) = delete;
+    TelemetryService& operator = (TelemetryService&&) = delete;
+
+    /// @returns whether metrics are being served, i.e. whether recording them is worthwhile at all.
+    inline bool IsEnabled() const
+    {
+        return mIsRunning.load(std::memory_order_relaxed);
+    }
+
+    /// Sets the current value of a gauge.
+    /// @param[in] metricName the name of the gauge, optionally followed by its labels (e.g. name{system="RenderingSystem"}).
+    /// @param[in] value the current value of the gauge.
+    void SetGauge(const std::string& metricName, const double value);
+
+    /// Adds a sample to a (cumulative) duration histogram \see HISTOGRAM_BUCKET_UPPER_BOUNDS_MILLISECONDS
+    /// @param[in] metricName the name of the histogram.
+    /// @param[in] milliseconds the duration sample to add.
+    void RecordHistogramSample(const std::string& metricName, const double milliseconds);
+
+    /// Makes all metrics recorded so far visible to scrapers.
+    void Publish();
+
+private:
+    struct Histogram
+    {
+        std::array<std::size_t, HISTOGRAM_BUCKET_UPPER_BOUNDS_MILLISECONDS.size()> mBucketCounts = {};
+        std::size_t mSampleCount = 0U;
+        double mSampleSum        = 0.0;
+    };
+
+    TelemetryService() = default;
+
+    void Initialize(const int port);
+    void ServeConnections(const int port);
+    std::string FormatMetrics() const;
+
+    std::map<std::string, double> mStagedGauges;
+    std::map<std::string, Histogram> mStagedHistograms;
+
+    mutable std::mutex mPublishedMetricsMutex;
+    std::map<std::string, double> mPublishedGauges;
+    std::map<std::string, Histogram> mPublishedHistograms;
+
+    std::atomic<bool> mIsRunning{false};
+    std::thread mServerThread;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* TelemetryService_h */
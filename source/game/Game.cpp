@@ -37,31 +37,68 @@
 
 ///------------------------------------------------------------------------------------------------
 
-void Game::VOnSystemsInit()
+// The extent of the unit sphere model (res/models/sphere.obj), for runs that can not load it
+static const glm::vec3 HEADLESS_SPHERE_DIMENSIONS = glm::vec3(2.0f, 2.0f, 2.0f);
+
+///------------------------------------------------------------------------------------------------
+
+void Game::VOnSystemsInit(const genesis::GameStartupParameters& startupParameters)
 {
+    mIsHeadless = startupParameters.mIsHeadless;
+    
     auto& world = genesis::ecs::World::GetInstance();
-    world.AddSystem(std::make_unique<genesis::input::RawInputHandlingSystem>());
-    world.AddSystem(std::make_unique<genesis::scripting::ScriptingSystem>());
+    if (!mIsHeadless)
+    {
+        world.AddSystem(std::make_unique<genesis::input::RawInputHandlingSystem>(world));
+    }
+    
+    world.AddSystem(std::make_unique<genesis::scripting::ScriptingSystem>(world));
 
 #if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
-    world.AddSystem(std::make_unique<genesis::debug::ConsoleManagementSystem>());
-    world.AddSystem(std::make_unique<genesis::debug::DebugViewManagementSystem>());
+    if (!mIsHeadless)
+    {
+        world.AddSystem(std::make_unique<genesis::debug::ConsoleManagementSystem>(world));
+        world.AddSystem(std::make_unique<genesis::debug::DebugViewManagementSystem>(world));
+    }
 #endif
     
-    world.AddSystem(std::make_unique<physics::PhysicsMovementApplicationSystem>());
-    world.AddSystem(std::make_unique<scene::SceneUpdaterSystem>());
-    world.AddSystem(std::make_unique<physics::PhysicsCollisionDetectionSystem>());
-    world.AddSystem(std::make_unique<physics::PhysicsCollisionResponseSystem>());
+    world.AddSystem(std::make_unique<physics::PhysicsMovementApplicationSystem>(world));
+    world.AddSystem(std::make_unique<scene::SceneUpdaterSystem>(world));
+    world.AddSystem(std::make_unique<physics::PhysicsCollisionDetectionSystem>(world));
+    world.AddSystem(std::make_unique<physics::PhysicsCollisionResponseSystem>(world));
     
-    world.AddSystem(std::make_unique<genesis::rendering::RenderingSystem>());
+    if (!mIsHeadless)
+    {
+        world.AddSystem(std::make_unique<genesis::rendering::RenderingSystem>(world));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void SetRandomSphereMotion(const genesis::ecs::EntityId sphereEntityId, const glm::vec3& collidableDimensions)
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    
+    auto& transformComponent = world.GetComponent<genesis::TransformComponent>(sphereEntityId);
+    transformComponent.mRotation.y = genesis::math::RandomFloat(0.0f, genesis::math::PI);
+    
+    auto& physicsComponent = world.AddComponent<physics::PhysicsComponent>(sphereEntityId);
+    physicsComponent.mCollidableDimensions = collidableDimensions;
+    physicsComponent.mDirection = glm::vec3(genesis::math::RandomFloat(-1.0f, 1.0f), genesis::math::RandomFloat(-1.0f, 1.0f), 0.0f);
+    physicsComponent.mDirection = glm::normalize(physicsComponent.mDirection);
+    //physicsComponent.mVelocitySpeed = 0.2f;
+    //physicsComponent.mRotationalSpeed = 0.3f;
 }
 
 ///------------------------------------------------------------------------------------------------
 
 static void CreateSphereAtRandomPosition(const int i)
 {
+    auto& world = genesis::ecs::World::GetInstance();
+    
     const auto sphereEntityId = genesis::rendering::LoadAndCreateModelByName
     (
+        world,
         "sphere",
         glm::vec3(-1.0f + i * 0.5f, 0.0f, 0.0f),
         glm::vec3(0.0f, 0.0f, 0.0f),
@@ -69,11 +106,7 @@ static void CreateSphereAtRandomPosition(const int i)
         StringId("sphere")
     );
     
-    auto& world = genesis::ecs::World::GetInstance();
-    
-    auto& transformComponent = world.GetComponent<genesis::TransformComponent>(sphereEntityId);
-    transformComponent.mRotation.y = genesis::math::RandomFloat(0.0f, genesis::math::PI);
-    
+    const auto& transformComponent = world.GetComponent<genesis::TransformComponent>(sphereEntityId);
     auto& renderableComponent = world.GetComponent<genesis::rendering::RenderableComponent>(sphereEntityId);
     auto& resource = genesis::resources::ResourceLoadingService::GetInstance().GetResource<genesis::resources::MeshResource>(renderableComponent.mMeshResourceId);
     
@@ -83,27 +116,48 @@ static void CreateSphereAtRandomPosition(const int i)
     renderableComponent.mMaterial.mShininess = 32.0f;
     renderableComponent.mIsAffectedByLight   = true;
     
-    auto physicsComponent = std::make_unique<physics::PhysicsComponent>();
-    physicsComponent->mCollidableDimensions = transformComponent.mScale * resource.GetDimensions();
-    physicsComponent->mDirection = glm::vec3(genesis::math::RandomFloat(-1.0f, 1.0f), genesis::math::RandomFloat(-1.0f, 1.0f), 0.0f);
-    physicsComponent->mDirection = glm::normalize(physicsComponent->mDirection);
-    //physicsComponent->mVelocitySpeed = 0.2f;
-    //physicsComponent->mRotationalSpeed = 0.3f;
+    // The entity's existing component references are invalidated once the new component is added
+    SetRandomSphereMotion(sphereEntityId, transformComponent.mScale * resource.GetDimensions());
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void CreateHeadlessSphereAtRandomPosition(const int i)
+{
+    // Without a GL context the sphere mesh can not be loaded, so only its simulated state is created
+    auto& world = genesis::ecs::World::GetInstance();
+    const auto sphereEntityId = world.CreateEntity(StringId("sphere"));
+    
+    auto& transformComponent = world.AddComponent<genesis::TransformComponent>(sphereEntityId);
+    transformComponent.mPosition = glm::vec3(-1.0f + i * 0.5f, 0.0f, 0.0f);
+    transformComponent.mScale    = glm::vec3(0.3f, 0.3f, 0.3f);
     
-    world.AddComponent<physics::PhysicsComponent>(sphereEntityId, std::move(physicsComponent));
+    SetRandomSphereMotion(sphereEntityId, transformComponent.mScale * HEADLESS_SPHERE_DIMENSIONS);
 }
 
+///------------------------------------------------------------------------------------------------
+
 void Game::VOnGameInit()
 {
+    if (mIsHeadless)
+    {
+        for (int i = 0; i < 5; ++i)
+        {
+            CreateHeadlessSphereAtRandomPosition(i);
+        }
+        return;
+    }
+    
     RegisterConsoleCommands();
     for (int i = 0; i < 5; ++i)
     {
         CreateSphereAtRandomPosition(i);
     }
     
-    genesis::rendering::AddLightSource(glm::vec3(0.0f, 0.0f, 1.0f), 4.0f);
-    //genesis::rendering::AddLightSource(glm::vec3(0.0f, 4.0f, 0.0f), 4.0f);
-    genesis::rendering::AddLightSource(glm::vec3(2.0f, 2.0f, 0.0f), 4.0f);
+    auto& world = genesis::ecs::World::GetInstance();
+    genesis::rendering::AddLightSource(world, glm::vec3(0.0f, 0.0f, 1.0f), 4.0f);
+    //genesis::rendering::AddLightSource(world, glm::vec3(0.0f, 4.0f, 0.0f), 4.0f);
+    genesis::rendering::AddLightSource(world, glm::vec3(2.0f, 2.0f, 0.0f), 4.0f);
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -112,6 +166,12 @@ static float dtAccum = 0.0f;
 
 void Game::VOnUpdate(const float dt)
 {
+    // Camera and lights only exist to be presented
+    if (mIsHeadless)
+    {
+        return;
+    }
+    
     auto& world = genesis::ecs::World::GetInstance();
 
     auto& cameraComponent = world.GetSingletonComponent<genesis::rendering::CameraSingletonComponent>();
@@ -17,13 +17,14 @@
 class Game final: public genesis::IGame
 {
 public:    
-    void VOnSystemsInit() override;
+    void VOnSystemsInit(const genesis::GameStartupParameters& startupParameters) override;
     void VOnGameInit() override;
     void VOnUpdate(const float dt) override;
 
 private:
     void RegisterConsoleCommands() const;
     
+    bool mIsHeadless = false;
 };       
 
 ///------------------------------------------------------------------------------------------------
@@ -8,17 +8,59 @@
 #include "Game.h"
 #include "../engine/GenesisEngine.h"
 
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
 #if defined(_WIN32) && !defined(NDEBUG)
 #include <vld.h>
 #endif
 
 ///------------------------------------------------------------------------------------------------
 
-int main(int, char**)
+int main(int argc, char** argv)
 {
     genesis::GenesisEngine engine;
     genesis::GameStartupParameters startupParameters("Genesis", 0.7f);
     
+    // Usage: Genesis [--headless [--ticks <count>]] [--telemetry-port <port>]
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument == "--headless")
+        {
+            startupParameters.mIsHeadless = true;
+        }
+        else if (argument == "--ticks" && i + 1 < argc)
+        {
+            // Only non negative tick counts are valid (with 0 running indefinitely)
+            const char* tickCountString = argv[++i];
+            char* tickCountStringEnd    = nullptr;
+            const auto tickCount        = std::strtoll(tickCountString, &tickCountStringEnd, 10);
+            if (tickCountStringEnd == tickCountString || *tickCountStringEnd != '\0' || tickCount < 0)
+            {
+                std::fprintf(stderr, "Invalid --ticks value '%s', expected a non negative tick count\n", tickCountString);
+                return EXIT_FAILURE;
+            }
+            
+            startupParameters.mHeadlessSimulationTickCount = tickCount;
+        }
+        else if (argument == "--telemetry-port" && i + 1 < argc)
+        {
+            // Port 0 would have the OS pick an arbitrary port, so only explicit ports are valid
+            const char* portString = argv[++i];
+            char* portStringEnd    = nullptr;
+            const auto port        = std::strtol(portString, &portStringEnd, 10);
+            if (portStringEnd == portString || *portStringEnd != '\0' || port < 1 || port > 65535)
+            {
+                std::fprintf(stderr, "Invalid --telemetry-port value '%s', expected a port in 1..65535\n", portString);
+                return EXIT_FAILURE;
+            }
+            
+            startupParameters.mTelemetryPort = static_cast<int>(port);
+        }
+    }
+    
     Game game;
     engine.RunGame(startupParameters, game);
 }
@@ -10,6 +10,7 @@
 #include "../../scene/components/SceneStateSingletonComponent.h"
 #include "../../scene/scenegraphs/ISceneGraph.h"
 #include "../../../engine/common/components/TransformComponent.h"
+#include "../../../engine/jobs/JobSystem.h"
 
 ///-----------------------------------------------------------------------------------------------
 
@@ -18,38 +19,70 @@ namespace physics
 
 ///-----------------------------------------------------------------------------------------------
 
-PhysicsCollisionDetectionSystem::PhysicsCollisionDetectionSystem()
+namespace
 {
+    const std::size_t COLLISION_TEST_CHUNK_SIZE = 64U;
+    
+    struct CollisionTestEntry
+    {
+        genesis::ecs::EntityId mEntityId;
+        const PhysicsComponent* mPhysicsComponent;
+        const genesis::TransformComponent* mTransformComponent;
+        std::vector<genesis::ecs::EntityId> mCollidedEntityIds;
+    };
+}
+
+///-----------------------------------------------------------------------------------------------
+
+PhysicsCollisionDetectionSystem::PhysicsCollisionDetectionSystem(genesis::ecs::World& world)
+    : BaseSystem(world)
+{
+    DeclareReadAccess<genesis::TransformComponent, scene::SceneStateSingletonComponent>();
 }
 
 ///-----------------------------------------------------------------------------------------------
 
-void PhysicsCollisionDetectionSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
+void PhysicsCollisionDetectionSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>&) const
 {
-    auto& world = genesis::ecs::World::GetInstance();
+    const auto& world = GetWorld();
     const auto& sceneGraph = world.GetSingletonComponent<scene::SceneStateSingletonComponent>().mSceneGraph;
     
-    for (const auto& entityId: entitiesToProcess)
+    std::vector<CollisionTestEntry> collisionTestEntries;
+    world.View<const PhysicsComponent, const genesis::TransformComponent>().ForEach([&collisionTestEntries](const genesis::ecs::EntityId entityId, const PhysicsComponent& physicsComponent, const genesis::TransformComponent& transformComponent)
     {
-        const auto& physicsComponent = world.GetComponent<PhysicsComponent>(entityId);
-        const auto& transformComponent = world.GetComponent<genesis::TransformComponent>(entityId);
-        
-        const auto& collisionCandidates = sceneGraph->VGetCollisionCandidates(entityId);
+        collisionTestEntries.push_back(CollisionTestEntry{ entityId, &physicsComponent, &transformComponent, {} });
+    });
+    
+    // Entities are tested concurrently, each one only writing to its own entry
+    genesis::jobs::ParallelFor(collisionTestEntries, COLLISION_TEST_CHUNK_SIZE, [&world, &sceneGraph](CollisionTestEntry& collisionTestEntry)
+    {
+        const auto& collisionCandidates = sceneGraph->VGetCollisionCandidates(collisionTestEntry.mEntityId);
         for (const auto& collisionCandidateEntityId: collisionCandidates)
         {
-            const auto& otherPhysicsComponent = world.GetComponent<PhysicsComponent>(collisionCandidateEntityId);
-            const auto& otherTransformComponent = world.GetComponent<genesis::TransformComponent>(collisionCandidateEntityId);
+            const auto& otherPhysicsComponent = world.GetComponent<const PhysicsComponent>(collisionCandidateEntityId);
+            const auto& otherTransformComponent = world.GetComponent<const genesis::TransformComponent>(collisionCandidateEntityId);
             
-            if (glm::distance(transformComponent.mPosition, otherTransformComponent.mPosition) < physicsComponent.mCollidableDimensions.x * 0.5f + otherPhysicsComponent.mCollidableDimensions.x * 0.5f)
+            if (glm::distance(collisionTestEntry.mTransformComponent->mPosition, otherTransformComponent.mPosition) < collisionTestEntry.mPhysicsComponent->mCollidableDimensions.x * 0.5f + otherPhysicsComponent.mCollidableDimensions.x * 0.5f)
             {
-                auto collidedComponentEntity = world.CreateEntity();
-                
-                auto collidedComponent = std::make_unique<CollidedEntitiesComponent>();
-                collidedComponent->mCollidedEntities = std::make_pair(entityId, collisionCandidateEntityId);
-                
-                world.AddComponent<CollidedEntitiesComponent>(collidedComponentEntity, std::move(collidedComponent));
+                collisionTestEntry.mCollidedEntityIds.push_back(collisionCandidateEntityId);
             }
         }
+    });
+    
+    // Collision pair entities are recorded serially in entity order, so that the entity ids they get and the
+    // order the response system processes them in do not depend on thread timing
+    auto& commandBuffer = GetCommandBuffer();
+    for (const auto& collisionTestEntry: collisionTestEntries)
+    {
+        for (const auto& collidedEntityId: collisionTestEntry.mCollidedEntityIds)
+        {
+            auto collidedComponentEntity = commandBuffer.CreateEntity();
+            
+            CollidedEntitiesComponent collidedComponent;
+            collidedComponent.mCollidedEntities = std::make_pair(collisionTestEntry.mEntityId, collidedEntityId);
+            
+            commandBuffer.AddComponent<CollidedEntitiesComponent>(collidedComponentEntity, std::move(collidedComponent));
+        }
     }
 }
 
@@ -20,12 +20,12 @@ namespace physics
 
 ///-----------------------------------------------------------------------------------------------
 
-class PhysicsCollisionDetectionSystem final : public genesis::ecs::BaseSystem<PhysicsComponent>
+class PhysicsCollisionDetectionSystem final : public genesis::ecs::BaseSystem<const PhysicsComponent>
 {
 public:
-    PhysicsCollisionDetectionSystem();
+    PhysicsCollisionDetectionSystem(genesis::ecs::World& world);
 
-    void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const override;
+    void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>&) const override;
 };
 
 ///-----------------------------------------------------------------------------------------------
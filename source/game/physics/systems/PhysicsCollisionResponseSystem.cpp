@@ -17,32 +17,36 @@ namespace physics
 
 ///-----------------------------------------------------------------------------------------------
 
-PhysicsCollisionResponseSystem::PhysicsCollisionResponseSystem()
+PhysicsCollisionResponseSystem::PhysicsCollisionResponseSystem(genesis::ecs::World& world)
+    : BaseSystem(world)
 {
+    DeclareReadAccess<genesis::TransformComponent>();
+    DeclareWriteAccess<PhysicsComponent>();
 }
 
 ///-----------------------------------------------------------------------------------------------
 
 void PhysicsCollisionResponseSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
 {
-    auto& world = genesis::ecs::World::GetInstance();
+    auto& world = GetWorld();
     
     for (const auto& collidedComponentEntity: entitiesToProcess)
     {
-        const auto& collidedComponent = world.GetComponent<CollidedEntitiesComponent>(collidedComponentEntity);
+        const auto& collidedComponent = world.GetComponent<const CollidedEntitiesComponent>(collidedComponentEntity);
             
         if (world.HasEntity(collidedComponent.mCollidedEntities.first) && world.HasEntity(collidedComponent.mCollidedEntities.second))
         {
-            auto& entity1TransformComponent = world.GetComponent<genesis::TransformComponent>(collidedComponent.mCollidedEntities.first);
-            auto& entity1PhysicsComponent   = world.GetComponent<PhysicsComponent>(collidedComponent.mCollidedEntities.first);
+            const auto& entity1TransformComponent = world.GetComponent<const genesis::TransformComponent>(collidedComponent.mCollidedEntities.first);
+            auto& entity1PhysicsComponent         = world.GetComponent<PhysicsComponent>(collidedComponent.mCollidedEntities.first);
                 
-            auto& entity2TransformComponent = world.GetComponent<genesis::TransformComponent>(collidedComponent.mCollidedEntities.second);
+            const auto& entity2TransformComponent = world.GetComponent<const genesis::TransformComponent>(collidedComponent.mCollidedEntities.second);
                 
             entity1PhysicsComponent.mDirection = glm::normalize(entity1TransformComponent.mPosition - entity2TransformComponent.mPosition);
             
         }
         
-        world.DestroyEntity(collidedComponentEntity);
+        // Collision pair entities are destroyed through the command buffer once the system's stage completes
+        GetCommandBuffer().DestroyEntity(collidedComponentEntity);
     }
 }
 
@@ -23,7 +23,7 @@ namespace physics
 class PhysicsCollisionResponseSystem final : public genesis::ecs::BaseSystem<CollidedEntitiesComponent>
 {
 public:
-    PhysicsCollisionResponseSystem();
+    PhysicsCollisionResponseSystem(genesis::ecs::World& world);
 
     void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const override;
 };
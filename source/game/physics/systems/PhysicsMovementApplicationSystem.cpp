@@ -14,24 +14,22 @@ namespace physics
 
 ///-----------------------------------------------------------------------------------------------
 
-PhysicsMovementApplicationSystem::PhysicsMovementApplicationSystem()
+PhysicsMovementApplicationSystem::PhysicsMovementApplicationSystem(genesis::ecs::World& world)
+    : BaseSystem(world)
 {
 }
 
 ///-----------------------------------------------------------------------------------------------
 
-void PhysicsMovementApplicationSystem::VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
+void PhysicsMovementApplicationSystem::VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>&) const
 {
-    for (const auto& entityId: entitiesToProcess)
+    GetView().ParallelForEach([dt](const genesis::ecs::EntityId, PhysicsComponent& physicsComponent, genesis::TransformComponent& transformComponent)
     {
-        auto& physicsComponent = genesis::ecs::World::GetInstance().GetComponent<PhysicsComponent>(entityId);
-        auto& transformComponent = genesis::ecs::World::GetInstance().GetComponent<genesis::TransformComponent>(entityId);
-        
         transformComponent.mPosition += physicsComponent.mDirection * physicsComponent.mVelocitySpeed * dt;
         transformComponent.mRotation.y += physicsComponent.mRotationalSpeed * dt;
         
         physicsComponent.mDirection = glm::normalize(physicsComponent.mDirection);
-    }
+    });
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -24,9 +24,9 @@ namespace physics
 class PhysicsMovementApplicationSystem final : public genesis::ecs::BaseSystem<PhysicsComponent, genesis::TransformComponent>
 {
 public:
-    PhysicsMovementApplicationSystem();
+    PhysicsMovementApplicationSystem(genesis::ecs::World& world);
 
-    void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const override;
+    void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>&) const override;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -28,6 +28,7 @@ class SceneStateSingletonComponent final: public genesis::ecs::IComponent
 {
 public:
     std::unique_ptr<ISceneGraph> mSceneGraph;
+    std::size_t mSceneGraphEntityCount = 0U;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -21,8 +21,9 @@ static constexpr int MAX_DEPTH = 5;
 
 ///-----------------------------------------------------------------------------------------------
 
-QuadtreeSceneGraph::QuadtreeSceneGraph(const glm::vec3& position, const glm::vec3& dimensions, const int depth /* 0 */)
-    : mOrigin(position)
+QuadtreeSceneGraph::QuadtreeSceneGraph(const genesis::ecs::World& world, const glm::vec3& position, const glm::vec3& dimensions, const int depth /* 0 */)
+    : mWorld(world)
+    , mOrigin(position)
     , mDimensions(dimensions)
     , mDepth(depth)
 {
@@ -59,10 +60,8 @@ const glm::vec3& QuadtreeSceneGraph::VGetSceneDimensions() const
 
 std::list<genesis::ecs::EntityId> QuadtreeSceneGraph::VGetCollisionCandidates(const genesis::ecs::EntityId referenceEntityId) const
 {
-    const auto& world = genesis::ecs::World::GetInstance();
-    
-    const auto& entityPosition = world.GetComponent<genesis::TransformComponent>(referenceEntityId).mPosition;
-    const auto& entityCollidableDimensions = world.GetComponent<physics::PhysicsComponent>(referenceEntityId).mCollidableDimensions;
+    const auto& entityPosition = mWorld.GetComponent<const genesis::TransformComponent>(referenceEntityId).mPosition;
+    const auto& entityCollidableDimensions = mWorld.GetComponent<const physics::PhysicsComponent>(referenceEntityId).mCollidableDimensions;
     
     std::list<genesis::ecs::EntityId> collisionCandidates;
     InternalGetCollisionCandidates(referenceEntityId, entityPosition, entityCollidableDimensions, collisionCandidates);
@@ -74,12 +73,10 @@ std::list<genesis::ecs::EntityId> QuadtreeSceneGraph::VGetCollisionCandidates(co
 
 void QuadtreeSceneGraph::VPopulateSceneGraph(const std::vector<genesis::ecs::EntityId>& physicallySimulatedEntities)
 {
-    const auto& world = genesis::ecs::World::GetInstance();
-    
     for (const auto& entityId: physicallySimulatedEntities)
     {
-        const auto& entityPosition = world.GetComponent<genesis::TransformComponent>(entityId).mPosition;
-        const auto& entityCollidableDimensions = world.GetComponent<physics::PhysicsComponent>(entityId).mCollidableDimensions;
+        const auto& entityPosition = mWorld.GetComponent<const genesis::TransformComponent>(entityId).mPosition;
+        const auto& entityCollidableDimensions = mWorld.GetComponent<const physics::PhysicsComponent>(entityId).mCollidableDimensions;
         
         InsertObject(entityId, entityPosition, entityCollidableDimensions);
     }
@@ -176,10 +173,10 @@ void QuadtreeSceneGraph::Split()
     // Push inner quads a bit towards viewer to avoid z-fighting in debugging
     const auto zFrontPush = (mDepth + 1) * 0.01f;
     
-    mNodes[0] = std::make_unique<QuadtreeSceneGraph>(glm::vec3(mOrigin.x - quadWidth, mOrigin.y + quadHeight, mOrigin.z + zFrontPush), glm::vec3(halfWidth, halfHeight, 0.0f), mDepth + 1);
-    mNodes[1] = std::make_unique<QuadtreeSceneGraph>(glm::vec3(mOrigin.x + quadWidth, mOrigin.y + quadHeight, mOrigin.z + zFrontPush), glm::vec3(halfWidth, halfHeight, 0.0f), mDepth + 1);
-    mNodes[2] = std::make_unique<QuadtreeSceneGraph>(glm::vec3(mOrigin.x - quadWidth, mOrigin.y - quadHeight, mOrigin.z + zFrontPush), glm::vec3(halfWidth, halfHeight, 0.0f), mDepth + 1);
-    mNodes[3] = std::make_unique<QuadtreeSceneGraph>(glm::vec3(mOrigin.x + quadWidth, mOrigin.y - quadHeight, mOrigin.z + zFrontPush), glm::vec3(halfWidth, halfHeight, 0.0f), mDepth + 1);
+    mNodes[0] = std::make_unique<QuadtreeSceneGraph>(mWorld, glm::vec3(mOrigin.x - quadWidth, mOrigin.y + quadHeight, mOrigin.z + zFrontPush), glm::vec3(halfWidth, halfHeight, 0.0f), mDepth + 1);
+    mNodes[1] = std::make_unique<QuadtreeSceneGraph>(mWorld, glm::vec3(mOrigin.x + quadWidth, mOrigin.y + quadHeight, mOrigin.z + zFrontPush), glm::vec3(halfWidth, halfHeight, 0.0f), mDepth + 1);
+    mNodes[2] = std::make_unique<QuadtreeSceneGraph>(mWorld, glm::vec3(mOrigin.x - quadWidth, mOrigin.y - quadHeight, mOrigin.z + zFrontPush), glm::vec3(halfWidth, halfHeight, 0.0f), mDepth + 1);
+    mNodes[3] = std::make_unique<QuadtreeSceneGraph>(mWorld, glm::vec3(mOrigin.x + quadWidth, mOrigin.y - quadHeight, mOrigin.z + zFrontPush), glm::vec3(halfWidth, halfHeight, 0.0f), mDepth + 1);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -26,7 +26,7 @@ namespace scene
 class QuadtreeSceneGraph final: public ISceneGraph
 {
 public:
-    QuadtreeSceneGraph(const glm::vec3& origin, const glm::vec3& dimensions, const int depth = 0);
+    QuadtreeSceneGraph(const genesis::ecs::World& world, const glm::vec3& origin, const glm::vec3& dimensions, const int depth = 0);
     ~QuadtreeSceneGraph();
     
     const glm::vec3& VGetSceneOrigin() const override;
@@ -59,6 +59,7 @@ private:
     void InsertObject(const genesis::ecs::EntityId entityId, const glm::vec3& objectPosition, const glm::vec3& objectDimensions);
     
 private:
+    const genesis::ecs::World& mWorld;
     const glm::vec3 mOrigin;
     const glm::vec3 mDimensions;
     const int mDepth;
@@ -8,7 +8,9 @@
 #include "SceneUpdaterSystem.h"
 #include "../components/SceneStateSingletonComponent.h"
 #include "../scenegraphs/QuadtreeSceneGraph.h"
+#include "../../../engine/common/components/TransformComponent.h"
 #include "../../../engine/debug/components/DebugViewStateSingletonComponent.h"
+#include "../../../engine/rendering/components/RenderableComponent.h"
 #include "../../../engine/rendering/utils/MeshUtils.h"
 
 ///-----------------------------------------------------------------------------------------------
@@ -22,31 +24,56 @@ static const std::string DEBUG_SQUARE_ENTITY_NAME = "unit_xy_square";
 
 ///-----------------------------------------------------------------------------------------------
 
-SceneUpdaterSystem::SceneUpdaterSystem()
+SceneUpdaterSystem::SceneUpdaterSystem(genesis::ecs::World& world)
+    : BaseSystem(world)
 {
+    // Recreates the scene graph debug rectangle entities every frame
+    DeclareStructuralChanges();
+    DeclareReadAccess<genesis::TransformComponent>();
+    
     auto sceneStateComponent = std::make_unique<SceneStateSingletonComponent>();
-    sceneStateComponent->mSceneGraph = std::make_unique<QuadtreeSceneGraph>(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(2.5f, 2.5f, 0.0f));
-    genesis::ecs::World::GetInstance().SetSingletonComponent<SceneStateSingletonComponent>(std::move(sceneStateComponent));
+    sceneStateComponent->mSceneGraph = std::make_unique<QuadtreeSceneGraph>(GetWorld(), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(2.5f, 2.5f, 0.0f));
+    GetWorld().SetSingletonComponent<SceneStateSingletonComponent>(std::move(sceneStateComponent));
 }
 
 ///-----------------------------------------------------------------------------------------------
 
 void SceneUpdaterSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
 {
-    auto& world = genesis::ecs::World::GetInstance();
+    auto& world = GetWorld();
     auto& sceneStateComponent = world.GetSingletonComponent<SceneStateSingletonComponent>();
-    auto& debugViewStateComponent = world.GetSingletonComponent<genesis::debug::DebugViewStateSingletonComponent>();
     
-    sceneStateComponent.mSceneGraph->VClear();
-    sceneStateComponent.mSceneGraph->VPopulateSceneGraph(entitiesToProcess);
+    // The debug view is not registered on headless (or console-less) runs
+    const auto isSceneGraphDisplayEnabled = world.HasSingletonComponent<genesis::debug::DebugViewStateSingletonComponent>() &&
+        world.GetSingletonComponent<genesis::debug::DebugViewStateSingletonComponent>().mSceneGraphDisplayEnabled;
+    
+    // The scene graph only needs to be rebuilt when simulated entities have been added, removed, moved or resized
+    auto hasSceneChanged = entitiesToProcess.size() != sceneStateComponent.mSceneGraphEntityCount;
+    const auto onChangedEntities = [&hasSceneChanged](const std::size_t, const genesis::ecs::EntityId*, const physics::PhysicsComponent*)
+    {
+        hasSceneChanged = true;
+    };
+    
+    GetChangedView<genesis::TransformComponent>().ForEachChunk(onChangedEntities);
+    GetChangedView<physics::PhysicsComponent>().ForEachChunk(onChangedEntities);
+    
+    if (hasSceneChanged)
+    {
+        sceneStateComponent.mSceneGraph->VClear();
+        sceneStateComponent.mSceneGraph->VPopulateSceneGraph(entitiesToProcess);
+        sceneStateComponent.mSceneGraphEntityCount = entitiesToProcess.size();
+    }
     
     world.DestroyEntities(world.FindAllEntitiesWithName(DEBUG_SQUARE_ENTITY_NAME));
-    if (debugViewStateComponent.mSceneGraphDisplayEnabled)
+    if (isSceneGraphDisplayEnabled)
     {
         const auto& newDebugRectangles = sceneStateComponent.mSceneGraph->VGetDebugRenderRectangles();
         for (const auto& debugRectangleInfo: newDebugRectangles)
         {
-            genesis::rendering::LoadAndCreateModelByName(DEBUG_SQUARE_ENTITY_NAME, debugRectangleInfo.first, glm::vec3(), debugRectangleInfo.second, DEBUG_SQUARE_ENTITY_NAME);
+            const auto debugSquareEntityId = genesis::rendering::LoadAndCreateModelByName(GetWorld(), DEBUG_SQUARE_ENTITY_NAME, debugRectangleInfo.first, glm::vec3(), debugRectangleInfo.second, DEBUG_SQUARE_ENTITY_NAME);
+            
+            // Only the outline of the square texture is opaque, so the squares need to be blended over the scene behind them
+            world.GetComponent<genesis::rendering::RenderableComponent>(debugSquareEntityId).mIsTransparent = true;
         }
     }
 }
@@ -20,10 +20,10 @@ namespace scene
 
 ///-----------------------------------------------------------------------------------------------
 
-class SceneUpdaterSystem final : public genesis::ecs::BaseSystem<physics::PhysicsComponent>
+class SceneUpdaterSystem final : public genesis::ecs::BaseSystem<const physics::PhysicsComponent>
 {
 public:
-    SceneUpdaterSystem();
+    SceneUpdaterSystem(genesis::ecs::World& world);
 
     void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const override;
 };
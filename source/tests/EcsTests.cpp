@@ -0,0 +1,356 @@
+///------------------------------------------------------------------------------------------------
+///  EcsTests.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "Test.h"
+#include "../engine/ECS.h"
+#include "../engine/common/components/NameComponent.h"
+#include "../engine/common/utils/StringUtils.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const StringId TEST_ENTITY_NAME       = StringId("ecs_test_entity");
+    const StringId OTHER_TEST_ENTITY_NAME = StringId("ecs_other_test_entity");
+
+    const float TEST_FRAME_DT = 1.0f/60.0f;
+}
+
+///------------------------------------------------------------------------------------------------
+
+// Trivially copyable component, relocated with memcpy
+class TestValueComponent final: public genesis::ecs::IComponent
+{
+public:
+    TestValueComponent() = default;
+    TestValueComponent(const int value) : mValue(value) {}
+
+public:
+    int mValue = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+// Non trivially copyable component, relocated through its move constructor
+class TestLabelComponent final: public genesis::ecs::IComponent
+{
+public:
+    TestLabelComponent() = default;
+    TestLabelComponent(const std::string& label) : mLabel(label) {}
+
+public:
+    std::string mLabel;
+};
+
+///------------------------------------------------------------------------------------------------
+
+// Records the entities whose values changed since the system's previous update
+class ChangedValueRecorderSystem final: public genesis::ecs::BaseSystem<const TestValueComponent>
+{
+public:
+    ChangedValueRecorderSystem(genesis::ecs::World& world, std::vector<genesis::ecs::EntityId>& changedEntityIds)
+        : BaseSystem(world)
+        , mChangedEntityIds(changedEntityIds)
+    {
+    }
+
+    void VUpdate(const float, const std::vector<genesis::ecs::EntityId>&) const override
+    {
+        mChangedEntityIds.clear();
+        GetChangedView<TestValueComponent>().ForEach([this](const genesis::ecs::EntityId entityId, const TestValueComponent&)
+        {
+            mChangedEntityIds.push_back(entityId);
+        });
+    }
+
+private:
+    std::vector<genesis::ecs::EntityId>& mChangedEntityIds;
+};
+
+///------------------------------------------------------------------------------------------------
+
+static bool ContainsEntity(const std::vector<genesis::ecs::EntityId>& entityIds, const genesis::ecs::EntityId entityId)
+{
+    return std::find(entityIds.cbegin(), entityIds.cend(), entityId) != entityIds.cend();
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestStaleIdsAreRejectedAfterReclamation()
+{
+    genesis::ecs::World world;
+    const auto destroyedEntityId = world.CreateEntity();
+    world.AddComponent<TestValueComponent>(destroyedEntityId, 1);
+    world.DestroyEntity(destroyedEntityId);
+
+    // The slot is only reclaimed at the beginning of the next update
+    world.Update(TEST_FRAME_DT);
+    EXPECT(!world.HasEntity(destroyedEntityId));
+
+    const auto recycledEntityId = world.CreateEntity();
+    EXPECT(genesis::ecs::GetEntityIndex(recycledEntityId) == genesis::ecs::GetEntityIndex(destroyedEntityId));
+    EXPECT(genesis::ecs::GetEntityGeneration(recycledEntityId) != genesis::ecs::GetEntityGeneration(destroyedEntityId));
+    EXPECT(world.HasEntity(recycledEntityId));
+    EXPECT(!world.HasEntity(destroyedEntityId));
+
+    // Deferred commands targeting the stale id must not leak into the slot's new entity
+    genesis::ecs::EntityCommandBuffer commandBuffer;
+    commandBuffer.AddComponent<TestValueComponent>(destroyedEntityId, 2);
+    commandBuffer.DestroyEntity(destroyedEntityId);
+    commandBuffer.Playback(world);
+    EXPECT(world.HasEntity(recycledEntityId));
+    EXPECT(!world.HasComponent<TestValueComponent>(recycledEntityId));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestRemoveComponentKeepsRemainingRowsIntact()
+{
+    genesis::ecs::World world;
+
+    std::vector<genesis::ecs::EntityId> entityIds;
+    for (auto i = 0; i < 4; ++i)
+    {
+        entityIds.push_back(world.CreateEntity());
+        world.AddComponent<TestValueComponent>(entityIds.back(), i);
+        world.AddComponent<TestLabelComponent>(entityIds.back(), "label_" + std::to_string(i));
+    }
+
+    // Removing from the first row swaps the last row into it, in every column of the archetype
+    world.RemoveComponent<TestValueComponent>(entityIds[0]);
+    EXPECT(!world.HasComponent<TestValueComponent>(entityIds[0]));
+    EXPECT(world.GetComponent<const TestLabelComponent>(entityIds[0]).mLabel == "label_0");
+
+    for (auto i = 1; i < 4; ++i)
+    {
+        EXPECT(world.GetComponent<const TestValueComponent>(entityIds[i]).mValue == i);
+        EXPECT(world.GetComponent<const TestLabelComponent>(entityIds[i]).mLabel == "label_" + std::to_string(i));
+    }
+
+    // Removing from a middle row of the moved entity's new archetype
+    world.RemoveComponent<TestLabelComponent>(entityIds[2]);
+    EXPECT(world.GetComponent<const TestValueComponent>(entityIds[2]).mValue == 2);
+    EXPECT(world.GetComponent<const TestLabelComponent>(entityIds[1]).mLabel == "label_1");
+    EXPECT(world.GetComponent<const TestLabelComponent>(entityIds[3]).mLabel == "label_3");
+
+    auto viewedEntityCount = 0;
+    world.View<const TestValueComponent, const TestLabelComponent>().ForEach([&](const genesis::ecs::EntityId entityId, const TestValueComponent& valueComponent, const TestLabelComponent& labelComponent)
+    {
+        EXPECT(entityId == entityIds[valueComponent.mValue]);
+        EXPECT(labelComponent.mLabel == "label_" + std::to_string(valueComponent.mValue));
+        viewedEntityCount++;
+    });
+    EXPECT(viewedEntityCount == 2);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestCommandBufferResolvesTemporaryIdsOnPlayback()
+{
+    genesis::ecs::World world;
+    genesis::ecs::EntityCommandBuffer commandBuffer;
+
+    const auto firstTemporaryEntityId = commandBuffer.CreateEntity();
+    const auto secondTemporaryEntityId = commandBuffer.CreateEntity();
+    const auto discardedTemporaryEntityId = commandBuffer.CreateEntity();
+    EXPECT(firstTemporaryEntityId < 0 && secondTemporaryEntityId < 0 && discardedTemporaryEntityId < 0);
+    EXPECT(firstTemporaryEntityId != secondTemporaryEntityId);
+
+    commandBuffer.AddComponent<genesis::NameComponent>(firstTemporaryEntityId, TEST_ENTITY_NAME);
+    commandBuffer.AddComponent<TestValueComponent>(firstTemporaryEntityId, 1);
+    commandBuffer.AddComponent<genesis::NameComponent>(secondTemporaryEntityId, OTHER_TEST_ENTITY_NAME);
+    commandBuffer.AddComponent<TestLabelComponent>(secondTemporaryEntityId, "second");
+    commandBuffer.AddComponent<TestValueComponent>(discardedTemporaryEntityId, 3);
+    commandBuffer.DestroyEntity(discardedTemporaryEntityId);
+    EXPECT(world.GetEntityCount() == 0U);
+
+    commandBuffer.Playback(world);
+    EXPECT(commandBuffer.IsEmpty());
+
+    const auto firstEntityId = world.FindEntityWithName(TEST_ENTITY_NAME);
+    const auto secondEntityId = world.FindEntityWithName(OTHER_TEST_ENTITY_NAME);
+    EXPECT(firstEntityId > 0 && secondEntityId > 0 && firstEntityId != secondEntityId);
+    if (firstEntityId > 0 && secondEntityId > 0)
+    {
+        EXPECT(world.GetComponent<const TestValueComponent>(firstEntityId).mValue == 1);
+        EXPECT(!world.HasComponent<TestLabelComponent>(firstEntityId));
+        EXPECT(world.GetComponent<const TestLabelComponent>(secondEntityId).mLabel == "second");
+        EXPECT(!world.HasComponent<TestValueComponent>(secondEntityId));
+    }
+
+    auto valueComponentCount = 0;
+    world.View<const TestValueComponent>().ForEach([&](const genesis::ecs::EntityId, const TestValueComponent&)
+    {
+        valueComponentCount++;
+    });
+    EXPECT(valueComponentCount == 1);
+
+    // Temporary ids are per playback, so a reused buffer hands out fresh entities
+    const auto reusedTemporaryEntityId = commandBuffer.CreateEntity();
+    commandBuffer.AddComponent<TestValueComponent>(reusedTemporaryEntityId, 4);
+    commandBuffer.Playback(world);
+    EXPECT(world.GetComponent<const TestValueComponent>(firstEntityId).mValue == 1);
+
+    valueComponentCount = 0;
+    world.View<const TestValueComponent>().ForEach([&](const genesis::ecs::EntityId, const TestValueComponent&)
+    {
+        valueComponentCount++;
+    });
+    EXPECT(valueComponentCount == 2);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestObserversFireOnceAtFlush()
+{
+    genesis::ecs::World world;
+
+    auto addCount = 0;
+    auto removeCount = 0;
+    auto changeCount = 0;
+    world.OnAdd<TestValueComponent>([&](const genesis::ecs::EntityId, const TestValueComponent&) { addCount++; });
+    world.OnRemove<TestValueComponent>([&](const genesis::ecs::EntityId) { removeCount++; });
+    world.OnChange<TestValueComponent>([&](const genesis::ecs::EntityId, const TestValueComponent&) { changeCount++; });
+
+    const auto firstEntityId = world.CreateEntity();
+    const auto secondEntityId = world.CreateEntity();
+    world.AddComponent<TestValueComponent>(firstEntityId, 1);
+    world.AddComponent<TestValueComponent>(secondEntityId, 2);
+
+    // Nothing is observed in the middle of structural changes
+    EXPECT(addCount == 0 && removeCount == 0 && changeCount == 0);
+
+    world.Update(TEST_FRAME_DT);
+    EXPECT(addCount == 2);
+    EXPECT(removeCount == 0);
+    EXPECT(changeCount == 2);
+
+    // Without any access nothing is observed again
+    world.Update(TEST_FRAME_DT);
+    EXPECT(addCount == 2 && removeCount == 0 && changeCount == 2);
+
+    // Only mutable accesses count as changes, and repeated ones are observed once
+    world.GetComponent<TestValueComponent>(firstEntityId).mValue = 10;
+    world.GetComponent<TestValueComponent>(firstEntityId).mValue = 11;
+    (void)world.GetComponent<const TestValueComponent>(secondEntityId);
+    world.Update(TEST_FRAME_DT);
+    EXPECT(addCount == 2 && removeCount == 0 && changeCount == 3);
+
+    // Both explicit removals and destructions are observed
+    world.RemoveComponent<TestValueComponent>(firstEntityId);
+    world.DestroyEntity(secondEntityId);
+    EXPECT(removeCount == 0);
+    world.Update(TEST_FRAME_DT);
+    EXPECT(addCount == 2 && removeCount == 2 && changeCount == 3);
+
+    // A component added and removed before the flush is not observed as added
+    world.AddComponent<TestValueComponent>(firstEntityId, 5);
+    world.RemoveComponent<TestValueComponent>(firstEntityId);
+    world.Update(TEST_FRAME_DT);
+    EXPECT(addCount == 2 && removeCount == 3 && changeCount == 3);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestChangedFilterOnlyYieldsChangedComponents()
+{
+    genesis::ecs::World world;
+
+    std::vector<genesis::ecs::EntityId> changedEntityIds;
+    world.AddSystem(std::make_unique<ChangedValueRecorderSystem>(world, changedEntityIds));
+
+    std::vector<genesis::ecs::EntityId> entityIds;
+    for (auto i = 0; i < 3; ++i)
+    {
+        entityIds.push_back(world.CreateEntity());
+        world.AddComponent<TestValueComponent>(entityIds.back(), i);
+    }
+
+    // Additions count as changes
+    world.Update(TEST_FRAME_DT);
+    EXPECT(changedEntityIds.size() == 3U);
+
+    world.Update(TEST_FRAME_DT);
+    EXPECT(changedEntityIds.empty());
+
+    world.GetComponent<TestValueComponent>(entityIds[1]).mValue = 10;
+    (void)world.GetComponent<const TestValueComponent>(entityIds[2]);
+    world.Update(TEST_FRAME_DT);
+    EXPECT(changedEntityIds.size() == 1U);
+    EXPECT(ContainsEntity(changedEntityIds, entityIds[1]));
+
+    // Structural changes relocate components along with their change ticks, without stamping them
+    world.AddComponent<TestLabelComponent>(entityIds[0], "moved");
+    world.Update(TEST_FRAME_DT);
+    EXPECT(changedEntityIds.empty());
+
+    world.GetComponent<TestValueComponent>(entityIds[0]).mValue = 20;
+    world.Update(TEST_FRAME_DT);
+    EXPECT(changedEntityIds.size() == 1U);
+    EXPECT(ContainsEntity(changedEntityIds, entityIds[0]));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestFindAllEntitiesWithNameSkipsDestroyedEntities()
+{
+    genesis::ecs::World world;
+    const auto firstEntityId = world.CreateEntity(TEST_ENTITY_NAME);
+    const auto secondEntityId = world.CreateEntity(TEST_ENTITY_NAME);
+    const auto otherEntityId = world.CreateEntity(OTHER_TEST_ENTITY_NAME);
+
+    auto namedEntityIds = world.FindAllEntitiesWithName(TEST_ENTITY_NAME);
+    EXPECT(namedEntityIds.size() == 2U);
+    EXPECT(ContainsEntity(namedEntityIds, firstEntityId) && ContainsEntity(namedEntityIds, secondEntityId));
+
+    // Destroyed entities leave the index right away, not only once their slot is reclaimed
+    world.DestroyEntity(firstEntityId);
+    namedEntityIds = world.FindAllEntitiesWithName(TEST_ENTITY_NAME);
+    EXPECT(namedEntityIds.size() == 1U);
+    EXPECT(ContainsEntity(namedEntityIds, secondEntityId));
+    EXPECT(world.FindEntityWithName(TEST_ENTITY_NAME) == secondEntityId);
+
+    world.Update(TEST_FRAME_DT);
+    const auto recycledEntityId = world.CreateEntity(TEST_ENTITY_NAME);
+    namedEntityIds = world.FindAllEntitiesWithName(TEST_ENTITY_NAME);
+    EXPECT(namedEntityIds.size() == 2U);
+    EXPECT(ContainsEntity(namedEntityIds, secondEntityId) && ContainsEntity(namedEntityIds, recycledEntityId));
+    EXPECT(!ContainsEntity(namedEntityIds, firstEntityId));
+
+    world.DestroyEntities(std::vector<genesis::ecs::EntityId>{ secondEntityId, recycledEntityId });
+    EXPECT(world.FindAllEntitiesWithName(TEST_ENTITY_NAME).empty());
+    EXPECT(world.FindEntityWithName(TEST_ENTITY_NAME) == genesis::ecs::NULL_ENTITY_ID);
+    EXPECT(world.FindEntityWithName(OTHER_TEST_ENTITY_NAME) == otherEntityId);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void RegisterEcsTests(std::vector<TestCase>& testCases)
+{
+    testCases.push_back({ "ecs_stale_ids_are_rejected_after_reclamation", TestStaleIdsAreRejectedAfterReclamation });
+    testCases.push_back({ "ecs_remove_component_keeps_remaining_rows_intact", TestRemoveComponentKeepsRemainingRowsIntact });
+    testCases.push_back({ "ecs_command_buffer_resolves_temporary_ids_on_playback", TestCommandBufferResolvesTemporaryIdsOnPlayback });
+    testCases.push_back({ "ecs_observers_fire_once_at_flush", TestObserversFireOnceAtFlush });
+    testCases.push_back({ "ecs_changed_filter_only_yields_changed_components", TestChangedFilterOnlyYieldsChangedComponents });
+    testCases.push_back({ "ecs_find_all_entities_with_name_skips_destroyed_entities", TestFindAllEntitiesWithNameSkipsDestroyedEntities });
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,434 @@
+///------------------------------------------------------------------------------------------------
+///  RenderQueueTests.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "Test.h"
+#include "../engine/rendering/utils/RenderQueueUtils.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+using namespace genesis;
+using namespace genesis::rendering;
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const StringId TEST_SHADER_NAME = StringId("default_3d");
+    const std::size_t MIN_INSTANCED_BATCH_SIZE = 4U;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static bool IsSameAsStableSort(std::vector<DrawItem> drawItems)
+{
+    auto expectedDrawItems = drawItems;
+    std::stable_sort(expectedDrawItems.begin(), expectedDrawItems.end(), [](const DrawItem& lhs, const DrawItem& rhs)
+    {
+        return lhs.mSortKey < rhs.mSortKey;
+    });
+
+    std::vector<DrawItem> scratchDrawItems;
+    SortDrawItems(drawItems, scratchDrawItems);
+
+    return std::equal(drawItems.cbegin(), drawItems.cend(), expectedDrawItems.cbegin(), expectedDrawItems.cend(), [](const DrawItem& lhs, const DrawItem& rhs)
+    {
+        return lhs.mSortKey == rhs.mSortKey && lhs.mEntryIndex == rhs.mEntryIndex;
+    });
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<std::uint32_t> SortAndGetEntryIndices(std::vector<DrawItem> drawItems)
+{
+    std::vector<DrawItem> scratchDrawItems;
+    SortDrawItems(drawItems, scratchDrawItems);
+
+    std::vector<std::uint32_t> entryIndices;
+    for (const auto& drawItem: drawItems)
+    {
+        entryIndices.push_back(drawItem.mEntryIndex);
+    }
+    return entryIndices;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<DrawBatch> FormTestDrawBatches(const std::vector<DrawItem>& drawItems, const std::vector<int>& instancingGroups)
+{
+    // Items can share an instanced draw when they belong to the same (non negative) group
+    std::vector<DrawBatch> drawBatches;
+    FormDrawBatches(drawItems, MIN_INSTANCED_BATCH_SIZE, [&instancingGroups](const DrawItem& batchDrawItem, const DrawItem& drawItem)
+    {
+        const auto batchGroup = instancingGroups[batchDrawItem.mEntryIndex];
+        return batchGroup >= 0 && batchGroup == instancingGroups[drawItem.mEntryIndex];
+    }, drawBatches);
+    return drawBatches;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<DrawItem> CreateSequentialDrawItems(const std::size_t drawItemCount)
+{
+    std::vector<DrawItem> drawItems;
+    for (auto i = 0U; i < drawItemCount; ++i)
+    {
+        drawItems.push_back(DrawItem{ i, i });
+    }
+    return drawItems;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestSortMatchesStableSortOnRandomKeys()
+{
+    std::mt19937_64 randomEngine(42U);
+    for (const auto drawItemCount: { 0U, 1U, 2U, 3U, 255U, 256U, 257U, 5000U })
+    {
+        std::vector<DrawItem> drawItems;
+        for (auto i = 0U; i < drawItemCount; ++i)
+        {
+            drawItems.push_back(DrawItem{ randomEngine(), i });
+        }
+        EXPECT(IsSameAsStableSort(drawItems));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestSortIsStableForEqualKeys()
+{
+    // Few distinct keys, so that most items tie and only their original order tells them apart
+    std::mt19937_64 randomEngine(7U);
+    std::vector<DrawItem> drawItems;
+    for (auto i = 0U; i < 1000U; ++i)
+    {
+        drawItems.push_back(DrawItem{ (randomEngine() % 3U) << 40U, i });
+    }
+    EXPECT(IsSameAsStableSort(drawItems));
+
+    // All keys equal, so every byte is skipped and the order must be left untouched
+    std::vector<DrawItem> identicalDrawItems;
+    for (auto i = 0U; i < 100U; ++i)
+    {
+        identicalDrawItems.push_back(DrawItem{ 0xDEADBEEFULL, i });
+    }
+    EXPECT(IsSameAsStableSort(identicalDrawItems));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestSortWithSharedBytes()
+{
+    // Keys only differing in a single (odd or even) byte exercise an odd and an even number of passes,
+    // i.e. both ends of the buffer swap
+    std::mt19937_64 randomEngine(3U);
+    for (auto varyingByte = 0U; varyingByte < 8U; ++varyingByte)
+    {
+        std::vector<DrawItem> drawItems;
+        for (auto i = 0U; i < 500U; ++i)
+        {
+            drawItems.push_back(DrawItem{ 0x0123456789ABCDEFULL ^ ((randomEngine() & 0xFFULL) << (varyingByte * 8U)), i });
+        }
+        EXPECT(IsSameAsStableSort(drawItems));
+    }
+
+    std::vector<DrawItem> twoByteDrawItems;
+    for (auto i = 0U; i < 500U; ++i)
+    {
+        twoByteDrawItems.push_back(DrawItem{ ((randomEngine() & 0xFFULL) << 8U) | ((randomEngine() & 0xFFULL) << 48U), i });
+    }
+    EXPECT(IsSameAsStableSort(twoByteDrawItems));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestOpaqueItemsAreSortedFrontToBack()
+{
+    // Negative, mixed sign and signed zero depths, with the same state so that only depth decides the order
+    const std::vector<float> depths = { 100.0f, -0.5f, 0.0f, -100.0f, 1.0f, -0.0f, 0.5f, -1.0f, 3.5e10f, -3.5e10f };
+
+    std::vector<DrawItem> drawItems;
+    for (auto i = 0U; i < depths.size(); ++i)
+    {
+        drawItems.push_back(DrawItem{ CreateDrawItemSortKey(RenderPass::OPAQUE_GEOMETRY, TEST_SHADER_NAME, 1U, 2U, depths[i]), i });
+    }
+    EXPECT(IsSameAsStableSort(drawItems));
+
+    const auto entryIndices = SortAndGetEntryIndices(drawItems);
+    for (auto i = 1U; i < entryIndices.size(); ++i)
+    {
+        EXPECT(depths[entryIndices[i - 1]] <= depths[entryIndices[i]]);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestTransparentItemsAreSortedBackToFront()
+{
+    const std::vector<float> depths = { -3.0f, 10.0f, 0.25f, -0.25f, 2.0f, -50.0f, 0.0f };
+
+    // Different state per item, which must not override the depth order
+    std::vector<DrawItem> drawItems;
+    for (auto i = 0U; i < depths.size(); ++i)
+    {
+        drawItems.push_back(DrawItem{ CreateDrawItemSortKey(RenderPass::TRANSPARENT_GEOMETRY, StringId("shader_" + std::to_string(i)), i, 100U - i, depths[i]), i });
+    }
+    EXPECT(IsSameAsStableSort(drawItems));
+
+    const auto entryIndices = SortAndGetEntryIndices(drawItems);
+    for (auto i = 1U; i < entryIndices.size(); ++i)
+    {
+        EXPECT(depths[entryIndices[i - 1]] > depths[entryIndices[i]]);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestTransparentItemsAreSortedAfterOpaqueItems()
+{
+    // Transparent items are blended over whatever has been drawn already, so they need to follow every opaque
+    // item, including the ones further away from the viewer than them
+    const std::vector<DrawItem> drawItems =
+    {
+        DrawItem{ CreateDrawItemSortKey(RenderPass::TRANSPARENT_GEOMETRY, TEST_SHADER_NAME, 1U, 1U, 1.0f), 0U },
+        DrawItem{ CreateDrawItemSortKey(RenderPass::OPAQUE_GEOMETRY, TEST_SHADER_NAME, 1U, 1U, 5.0f), 1U },
+        DrawItem{ CreateDrawItemSortKey(RenderPass::TRANSPARENT_GEOMETRY, TEST_SHADER_NAME, 1U, 1U, 10.0f), 2U },
+        DrawItem{ CreateDrawItemSortKey(RenderPass::OPAQUE_GEOMETRY, TEST_SHADER_NAME, 1U, 1U, 20.0f), 3U },
+    };
+
+    EXPECT((SortAndGetEntryIndices(drawItems) == std::vector<std::uint32_t>{ 1U, 3U, 2U, 0U }));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestPassesAreSortedInExecutionOrder()
+{
+    const std::vector<DrawItem> drawItems =
+    {
+        DrawItem{ CreateDrawItemSortKey(RenderPass::GUI, TEST_SHADER_NAME, 1U, 1U, -10.0f), 0U },
+        DrawItem{ CreateDrawItemSortKey(RenderPass::TRANSPARENT_GEOMETRY, TEST_SHADER_NAME, 1U, 1U, 1000.0f), 1U },
+        DrawItem{ CreateDrawItemSortKey(RenderPass::OPAQUE_GEOMETRY, TEST_SHADER_NAME, 1U, 1U, 1000.0f), 2U },
+        DrawItem{ CreateDrawItemSortKey(RenderPass::GUI, TEST_SHADER_NAME, 1U, 1U, 10.0f), 3U },
+        DrawItem{ CreateDrawItemSortKey(RenderPass::OPAQUE_GEOMETRY, TEST_SHADER_NAME, 1U, 1U, -1000.0f), 4U },
+    };
+
+    for (const auto& drawItem: drawItems)
+    {
+        const auto expectedRenderPass = drawItem.mEntryIndex == 0U || drawItem.mEntryIndex == 3U ? RenderPass::GUI : drawItem.mEntryIndex == 1U ? RenderPass::TRANSPARENT_GEOMETRY : RenderPass::OPAQUE_GEOMETRY;
+        EXPECT(GetDrawItemRenderPass(drawItem.mSortKey) == expectedRenderPass);
+    }
+
+    EXPECT((SortAndGetEntryIndices(drawItems) == std::vector<std::uint32_t>{ 4U, 2U, 1U, 3U, 0U }));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestShortRunsAreNotInstanced()
+{
+    // A run of exactly the minimum size is instanced, shorter ones are issued individually
+    const auto drawItems = CreateSequentialDrawItems(9U);
+    const auto drawBatches = FormTestDrawBatches(drawItems, { 0, 0, 0, 1, 1, 1, 1, -1, 2 });
+
+    EXPECT(drawBatches.size() == 6U);
+    if (drawBatches.size() != 6U)
+    {
+        return;
+    }
+
+    for (auto i = 0U; i < 3U; ++i)
+    {
+        EXPECT(drawBatches[i].mFirstDrawItemIndex == i && drawBatches[i].mDrawItemCount == 1U && !drawBatches[i].mIsInstanced);
+    }
+    EXPECT(drawBatches[3].mFirstDrawItemIndex == 3U && drawBatches[3].mDrawItemCount == 4U && drawBatches[3].mIsInstanced);
+    EXPECT(drawBatches[4].mFirstDrawItemIndex == 7U && drawBatches[4].mDrawItemCount == 1U && !drawBatches[4].mIsInstanced);
+    EXPECT(drawBatches[5].mFirstDrawItemIndex == 8U && drawBatches[5].mDrawItemCount == 1U && !drawBatches[5].mIsInstanced);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestPredicateBreaksRunInTheMiddle()
+{
+    // An item that can not be instanced splits an otherwise long run in two
+    const auto drawItems = CreateSequentialDrawItems(11U);
+    const auto drawBatches = FormTestDrawBatches(drawItems, { 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0 });
+
+    EXPECT(drawBatches.size() == 3U);
+    if (drawBatches.size() != 3U)
+    {
+        return;
+    }
+
+    EXPECT(drawBatches[0].mFirstDrawItemIndex == 0U && drawBatches[0].mDrawItemCount == 5U && drawBatches[0].mIsInstanced);
+    EXPECT(drawBatches[1].mFirstDrawItemIndex == 5U && drawBatches[1].mDrawItemCount == 1U && !drawBatches[1].mIsInstanced);
+    EXPECT(drawBatches[2].mFirstDrawItemIndex == 6U && drawBatches[2].mDrawItemCount == 5U && drawBatches[2].mIsInstanced);
+
+    // A break leaving a too short remainder issues the remainder individually
+    const auto shortRemainderDrawBatches = FormTestDrawBatches(drawItems, { 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0 });
+    EXPECT(shortRemainderDrawBatches.size() == 4U);
+    if (shortRemainderDrawBatches.size() == 4U)
+    {
+        EXPECT(shortRemainderDrawBatches[0].mDrawItemCount == 8U && shortRemainderDrawBatches[0].mIsInstanced);
+        EXPECT(!shortRemainderDrawBatches[1].mIsInstanced && !shortRemainderDrawBatches[2].mIsInstanced && !shortRemainderDrawBatches[3].mIsInstanced);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestNonAdjacentTransparentItemsAreNotMerged()
+{
+    // Two materials interleaved back to front: merging items of the same material would break the blending order
+    const std::vector<float> depths = { 9.0f, 8.0f, 7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f };
+    const std::vector<int> instancingGroups = { 0, 1, 0, 1, 0, 1, 0, 1 };
+
+    std::vector<DrawItem> drawItems;
+    for (auto i = 0U; i < depths.size(); ++i)
+    {
+        drawItems.push_back(DrawItem{ CreateDrawItemSortKey(RenderPass::TRANSPARENT_GEOMETRY, TEST_SHADER_NAME, instancingGroups[i], 1U, depths[i]), i });
+    }
+
+    std::vector<DrawItem> scratchDrawItems;
+    SortDrawItems(drawItems, scratchDrawItems);
+
+    const auto drawBatches = FormTestDrawBatches(drawItems, instancingGroups);
+    EXPECT(drawBatches.size() == depths.size());
+    for (auto i = 0U; i < drawBatches.size(); ++i)
+    {
+        EXPECT(!drawBatches[i].mIsInstanced && drawBatches[i].mDrawItemCount == 1U);
+        EXPECT(drawItems[drawBatches[i].mFirstDrawItemIndex].mEntryIndex == i);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+static RenderableComponent CreateTestRenderable(const StringId& shaderNameId, const ResourceId textureResourceId, const ResourceId meshResourceId)
+{
+    RenderableComponent renderableComponent;
+    renderableComponent.mShaderNameId      = shaderNameId;
+    renderableComponent.mTextureResourceId = textureResourceId;
+    renderableComponent.mMeshResourceId    = meshResourceId;
+    return renderableComponent;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestOnlyCustomColorUniformsCanBeInstanced()
+{
+    const InstancedShaderVariantMap instancedShaderVariantNames = { { TEST_SHADER_NAME, StringId("default_3d_instanced") } };
+
+    // No parameter block at all, or an empty one
+    auto renderableComponent = CreateTestRenderable(TEST_SHADER_NAME, 1U, 1U);
+    EXPECT(CanBeInstanced(renderableComponent, instancedShaderVariantNames));
+
+    renderableComponent.mShaderParameters = std::make_shared<ShaderParameterBlock>();
+    EXPECT(CanBeInstanced(renderableComponent, instancedShaderVariantNames));
+
+    renderableComponent.mShaderParameters->SetFloatVec4(CUSTOM_COLOR_UNIFORM_NAME, glm::vec4(1.0f));
+    EXPECT(CanBeInstanced(renderableComponent, instancedShaderVariantNames));
+
+    // Any other parameter, even of the custom color's type, would need to be set per draw call
+    renderableComponent.mShaderParameters->SetFloatVec4(StringId("tint"), glm::vec4(1.0f));
+    EXPECT(!CanBeInstanced(renderableComponent, instancedShaderVariantNames));
+
+    auto otherVec4ParameterRenderableComponent = CreateTestRenderable(TEST_SHADER_NAME, 1U, 1U);
+    otherVec4ParameterRenderableComponent.mShaderParameters = std::make_shared<ShaderParameterBlock>();
+    otherVec4ParameterRenderableComponent.mShaderParameters->SetFloatVec4(StringId("tint"), glm::vec4(1.0f));
+    EXPECT(!CanBeInstanced(otherVec4ParameterRenderableComponent, instancedShaderVariantNames));
+
+    auto floatParameterRenderableComponent = CreateTestRenderable(TEST_SHADER_NAME, 1U, 1U);
+    floatParameterRenderableComponent.mShaderParameters = std::make_shared<ShaderParameterBlock>();
+    floatParameterRenderableComponent.mShaderParameters->SetFloat(StringId("time"), 1.0f);
+    EXPECT(!CanBeInstanced(floatParameterRenderableComponent, instancedShaderVariantNames));
+
+    // The custom color is only carried by the instance data as a single vec4
+    auto vec3CustomColorRenderableComponent = CreateTestRenderable(TEST_SHADER_NAME, 1U, 1U);
+    vec3CustomColorRenderableComponent.mShaderParameters = std::make_shared<ShaderParameterBlock>();
+    vec3CustomColorRenderableComponent.mShaderParameters->SetFloatVec3(CUSTOM_COLOR_UNIFORM_NAME, glm::vec3(1.0f));
+    EXPECT(!CanBeInstanced(vec3CustomColorRenderableComponent, instancedShaderVariantNames));
+
+    auto customColorArrayRenderableComponent = CreateTestRenderable(TEST_SHADER_NAME, 1U, 1U);
+    customColorArrayRenderableComponent.mShaderParameters = std::make_shared<ShaderParameterBlock>();
+    customColorArrayRenderableComponent.mShaderParameters->SetFloatVec4Array(CUSTOM_COLOR_UNIFORM_NAME, { glm::vec4(1.0f), glm::vec4(0.5f) });
+    EXPECT(!CanBeInstanced(customColorArrayRenderableComponent, instancedShaderVariantNames));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestShadersWithoutInstancedVariantCanNotBeInstanced()
+{
+    const InstancedShaderVariantMap instancedShaderVariantNames = { { TEST_SHADER_NAME, StringId("default_3d_instanced") } };
+
+    EXPECT(!CanBeInstanced(CreateTestRenderable(StringId("water"), 1U, 1U), instancedShaderVariantNames));
+    EXPECT(!CanBeInstanced(CreateTestRenderable(TEST_SHADER_NAME, 1U, 1U), InstancedShaderVariantMap()));
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void TestInstancedDrawsNeedMatchingPassAndState()
+{
+    const InstancedShaderVariantMap instancedShaderVariantNames =
+    {
+        { TEST_SHADER_NAME, StringId("default_3d_instanced") },
+        { StringId("default_gui"), StringId("default_gui_instanced") }
+    };
+
+    const auto batchRenderableComponent = CreateTestRenderable(TEST_SHADER_NAME, 1U, 2U);
+    const auto batchDrawItem = DrawItem{ CreateDrawItemSortKey(RenderPass::OPAQUE_GEOMETRY, TEST_SHADER_NAME, 1U, 2U, 1.0f), 0U };
+
+    // Depth does not matter, as it is per instance
+    const auto drawItem = DrawItem{ CreateDrawItemSortKey(RenderPass::OPAQUE_GEOMETRY, TEST_SHADER_NAME, 1U, 2U, 5.0f), 1U };
+    EXPECT(CanShareInstancedDraw(batchDrawItem, batchRenderableComponent, drawItem, CreateTestRenderable(TEST_SHADER_NAME, 1U, 2U), instancedShaderVariantNames));
+
+    const auto transparentDrawItem = DrawItem{ CreateDrawItemSortKey(RenderPass::TRANSPARENT_GEOMETRY, TEST_SHADER_NAME, 1U, 2U, 5.0f), 1U };
+    EXPECT(!CanShareInstancedDraw(batchDrawItem, batchRenderableComponent, transparentDrawItem, CreateTestRenderable(TEST_SHADER_NAME, 1U, 2U), instancedShaderVariantNames));
+
+    EXPECT(!CanShareInstancedDraw(batchDrawItem, batchRenderableComponent, drawItem, CreateTestRenderable(StringId("default_gui"), 1U, 2U), instancedShaderVariantNames));
+    EXPECT(!CanShareInstancedDraw(batchDrawItem, batchRenderableComponent, drawItem, CreateTestRenderable(TEST_SHADER_NAME, 3U, 2U), instancedShaderVariantNames));
+    EXPECT(!CanShareInstancedDraw(batchDrawItem, batchRenderableComponent, drawItem, CreateTestRenderable(TEST_SHADER_NAME, 1U, 3U), instancedShaderVariantNames));
+
+    // Matching state is not enough when either side can not be instanced
+    auto uniformRenderableComponent = CreateTestRenderable(TEST_SHADER_NAME, 1U, 2U);
+    uniformRenderableComponent.mShaderParameters = std::make_shared<ShaderParameterBlock>();
+    uniformRenderableComponent.mShaderParameters->SetInt(StringId("frame"), 1);
+    EXPECT(!CanShareInstancedDraw(batchDrawItem, batchRenderableComponent, drawItem, uniformRenderableComponent, instancedShaderVariantNames));
+    EXPECT(!CanShareInstancedDraw(batchDrawItem, uniformRenderableComponent, drawItem, batchRenderableComponent, instancedShaderVariantNames));
+}
+
+///------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+
+///------------------------------------------------------------------------------------------------
+
+void RegisterRenderQueueTests(std::vector<TestCase>& testCases)
+{
+    testCases.push_back({ "render_queue_sort_matches_stable_sort_on_random_keys", TestSortMatchesStableSortOnRandomKeys });
+    testCases.push_back({ "render_queue_sort_is_stable_for_equal_keys", TestSortIsStableForEqualKeys });
+    testCases.push_back({ "render_queue_sort_with_shared_bytes", TestSortWithSharedBytes });
+    testCases.push_back({ "render_queue_opaque_items_are_sorted_front_to_back", TestOpaqueItemsAreSortedFrontToBack });
+    testCases.push_back({ "render_queue_transparent_items_are_sorted_back_to_front", TestTransparentItemsAreSortedBackToFront });
+    testCases.push_back({ "render_queue_transparent_items_are_sorted_after_opaque_items", TestTransparentItemsAreSortedAfterOpaqueItems });
+    testCases.push_back({ "render_queue_passes_are_sorted_in_execution_order", TestPassesAreSortedInExecutionOrder });
+    testCases.push_back({ "render_queue_short_runs_are_not_instanced", TestShortRunsAreNotInstanced });
+    testCases.push_back({ "render_queue_predicate_breaks_run_in_the_middle", TestPredicateBreaksRunInTheMiddle });
+    testCases.push_back({ "render_queue_non_adjacent_transparent_items_are_not_merged", TestNonAdjacentTransparentItemsAreNotMerged });
+    testCases.push_back({ "render_queue_only_custom_color_uniforms_can_be_instanced", TestOnlyCustomColorUniformsCanBeInstanced });
+    testCases.push_back({ "render_queue_shaders_without_instanced_variant_can_not_be_instanced", TestShadersWithoutInstancedVariantCanNotBeInstanced });
+    testCases.push_back({ "render_queue_instanced_draws_need_matching_pass_and_state", TestInstancedDrawsNeedMatchingPassAndState });
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
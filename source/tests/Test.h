@@ -0,0 +1,59 @@
+///------------------------------------------------------------------------------------------------
+///  Test.h
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef Test_h
+#define Test_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <functional>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+/// Records a failed expectation (without aborting the test) if the given condition does not hold.
+#define EXPECT(condition) do { if (!(condition)) { tests::ReportFailedExpectation(__FILE__, __LINE__, #condition); } } while (0)
+
+///------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+
+///------------------------------------------------------------------------------------------------
+/// A named test. Test names are prefixed with the name of their suite (e.g. ecs_...), so that
+/// whole suites can be selected with a name filter.
+struct TestCase
+{
+    std::string mName;
+    std::function<void()> mFunction;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Reports a failed expectation of the currently running test. @see EXPECT
+/// @param[in] file the source file of the expectation.
+/// @param[in] line the source line of the expectation.
+/// @param[in] condition the text of the condition that did not hold.
+void ReportFailedExpectation(const char* file, const int line, const char* condition);
+
+///------------------------------------------------------------------------------------------------
+/// Adds the render queue tests (sorting, batch formation and the instancing predicate).
+/// @param[out] testCases the list to add the tests to.
+void RegisterRenderQueueTests(std::vector<TestCase>& testCases);
+
+///------------------------------------------------------------------------------------------------
+/// Adds the ECS behavior tests (entity handles, component storage, command buffers, observers and change filters).
+/// @param[out] testCases the list to add the tests to.
+void RegisterEcsTests(std::vector<TestCase>& testCases);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* Test_h */
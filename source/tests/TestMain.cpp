@@ -0,0 +1,89 @@
+///------------------------------------------------------------------------------------------------
+///  TestMain.cpp
+///  Genesis
+///
+///  Created by agent on 18/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "Test.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+///------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    int sFailureCount = 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ReportFailedExpectation(const char* file, const int line, const char* condition)
+{
+    std::printf("%s:%d: expectation failed: %s\n", file, line, condition);
+    sFailureCount++;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        std::fprintf(stderr, "Usage: GenesisTests [<name substring>]\n");
+        return EXIT_FAILURE;
+    }
+
+    const std::string nameFilter = argc == 2 ? argv[1] : "";
+
+    std::vector<tests::TestCase> testCases;
+    tests::RegisterRenderQueueTests(testCases);
+    tests::RegisterEcsTests(testCases);
+
+    auto testCount = 0;
+    auto failedTestCount = 0;
+    for (const auto& testCase: testCases)
+    {
+        if (testCase.mName.find(nameFilter) == std::string::npos)
+        {
+            continue;
+        }
+
+        const auto previousFailureCount = tests::sFailureCount;
+        testCase.mFunction();
+        testCount++;
+
+        if (tests::sFailureCount > previousFailureCount)
+        {
+            std::printf("FAILED %s\n", testCase.mName.c_str());
+            failedTestCount++;
+        }
+    }
+
+    if (testCount == 0)
+    {
+        std::printf("No tests match '%s'\n", nameFilter.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (failedTestCount > 0)
+    {
+        std::printf("%d of %d test(s) failed, %d expectation(s) failed\n", failedTestCount, testCount, tests::sFailureCount);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("All %d test(s) passed\n", testCount);
+    return EXIT_SUCCESS;
+}
+
+///------------------------------------------------------------------------------------------------